@@ -0,0 +1,86 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file align.h
+ */
+#ifndef LRDA_ALIGN_H
+#define LRDA_ALIGN_H
+
+/*! @uses size_t */
+#include <stddef.h>
+
+/*! @uses rda_dec_fun_t */
+#include "disas.h"
+
+/// @note the boundary a branch must not cross or end on (jcc erratum, skylake-derived cores).
+#define RDA_ALIGN_BRANCH 32
+
+/// @note the fetch line loop headers are aligned for.
+#define RDA_ALIGN_FETCH 64
+
+/// @note how a branch meets a RDA_ALIGN_BRANCH boundary, combined with |.
+typedef enum {
+	RDA_ALIGN_CROSSES = 0x1,		// the branch (or fused pair) spans a boundary.
+	RDA_ALIGN_ENDS = 0x2,			// the branch (or fused pair) ends right before a boundary.
+	RDA_ALIGN_FUSED = 0x4,			// the branch is a jcc macro-fused with the cmp/test/alu before it.
+} rda_align_fl_t;
+
+/**
+ * @note a jcc, jmp, call or ret that the jcc erratum microcode update keeps
+ *	out of the decoded icache; <padding> bytes inserted before <address>
+ *	(prefixes or nops) move it past the boundary.
+ */
+typedef struct {
+	size_t function;				// index of the function (as given to rda_align_create()).
+	size_t index;					// index of the branch within its function.
+	size_t address;					// start of the branch, of the fused pair if fused.
+	size_t offset;					// <address> - start of the function.
+	unsigned char length;			// bytes of the branch, of the fused pair if fused.
+	unsigned char flags;			// rda_align_fl_t.
+	unsigned char padding;			// bytes of padding before <address> that avoid the boundary.
+} rda_align_branch_t;
+
+/**
+ * @note a loop header (the target of a backward branch) that the loop fetches
+ *	more RDA_ALIGN_FETCH byte lines from than it has to; <padding> bytes
+ *	before the header bring the loop down to <min_lines>.
+ */
+typedef struct {
+	size_t function;				// index of the function (as given to rda_align_create()).
+	size_t index;					// index of the header within its function.
+	size_t address;					// start of the header.
+	size_t offset;					// <address> - start of the function.
+	size_t size;					// bytes from the header to the end of its last backward branch.
+	unsigned int lines, min_lines;	// fetch lines the loop spans, and at the best alignment.
+	unsigned char padding;			// bytes of padding before <address> that reach <min_lines>.
+} rda_align_loop_t;
+
+/// @note the alignment hazards of decoded functions, by function (as given), then by address.
+typedef struct {
+	size_t branch_count;			// number of <branches>.
+	rda_align_branch_t* branches;
+	size_t loop_count;				// number of <loops>.
+	rda_align_loop_t* loops;
+} rda_align_report_t;
+
+/**
+ * @brief find the branches of decoded amd64 functions that cross or end on a
+ *  RDA_ALIGN_BRANCH byte boundary, and the loop headers misaligned for the
+ *  RDA_ALIGN_FETCH byte fetch, by the runtime addresses of the instructions.
+ *
+ * @param functions decoded functions.
+ * @param count the number of <functions>.
+ * @return an allocated report or 0x0 on failure.
+ */
+rda_align_report_t*
+rda_align_create(rda_dec_fun_t** functions, size_t count);
+
+/**
+ * @brief free an alignment report.
+ *
+ * @param report the report to be freed.
+ */
+void
+rda_align_destroy(rda_align_report_t* report);
+#endif //LRDA_ALIGN_H
@@ -0,0 +1,67 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file arena.h
+ */
+#ifndef LRDA_ARENA_H
+#define LRDA_ARENA_H
+
+/*! @uses size_t */
+#include <stddef.h>
+
+/// @note the default size of an arena block in bytes.
+#define RDA_ARENA_BLOCK 65536
+
+/// @note a block of an arena, followed by its bytes.
+typedef struct rda_arena_block {
+	struct rda_arena_block* next;	// the previously filled block.
+	size_t size, used;				// size of the block and bytes handed out.
+} rda_arena_block_t;
+
+/**
+ * @note a bump allocator; memory is handed out from large blocks and only
+ *	released all at once (rda_arena_reset() or rda_arena_destroy()). an
+ *	arena is not thread-safe, share one between threads only with a lock.
+ */
+typedef struct {
+	rda_arena_block_t* head;		// the block being filled.
+	size_t block;					// the size of new blocks.
+} rda_arena_t;
+
+/**
+ * @brief create an arena.
+ *
+ * @param block the size of every block in bytes (0 for RDA_ARENA_BLOCK).
+ * @return an allocated arena or 0x0 on failure.
+ */
+rda_arena_t*
+rda_arena_create(size_t block);
+
+/**
+ * @brief allocate zeroed memory from an arena, aligned to max_align_t.
+ *
+ * @param arena the arena.
+ * @param size the number of bytes.
+ * @return the memory or 0x0 on failure.
+ */
+void*
+rda_arena_alloc(rda_arena_t* arena, size_t size);
+
+/**
+ * @brief release everything allocated from an arena, keeping a single block
+ *  for reuse.
+ *
+ * @param arena the arena.
+ */
+void
+rda_arena_reset(rda_arena_t* arena);
+
+/**
+ * @brief free an arena and everything allocated from it.
+ *
+ * @param arena the arena.
+ */
+void
+rda_arena_destroy(rda_arena_t* arena);
+#endif //LRDA_ARENA_H
@@ -0,0 +1,322 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file asmarm64.h
+ */
+#ifndef LRDA_ASMARM64_H
+#define LRDA_ASMARM64_H
+
+/*! @uses rda_int_ty_t */
+#include "asmx64.h"
+
+/**
+ * @note an aarch64 representation for an instruction class; every
+ *	aarch64 instruction is a fixed 4-byte little-endian word, so a row
+ *	matches a word when (word & mask) == value.
+ */
+typedef struct {
+	const char* mnemonic;			// mnemonic for the instruction.
+	unsigned int mask, value;		// encoding bits that must match, and their value.
+	rda_int_ty_t type;				// type of the instruction.
+	unsigned short flags;			// semantic attribute flags, see rda_int_fl_t.
+} rda_a64_int_t;
+
+/**
+ * @note the top level encoding group of an aarch64 word is op0, bits [28:25].
+ *	this table maps each group to its broad category, the decoder uses it
+ *	to classify a word before (and without) looking at the instruction rows.
+ *
+ *	0000 reserved / sme, 0010 sve, 100x data processing (immediate),
+ *	101x branches, exceptions and system, x1x0 loads and stores,
+ *	x101 data processing (register), x111 scalar fp and advanced simd.
+ */
+#if RDA_TABLE_DEFINE
+RDA_TABLE rda_int_ty_t internal_a64_group_table[16] = {
+	[0x0] = RDA_INST_TY_INVALID, [0x1] = RDA_INST_TY_INVALID,
+	[0x2] = RDA_INST_TY_SVE, [0x3] = RDA_INST_TY_INVALID,
+	[0x4] = RDA_INST_TY_DATA, [0x5] = RDA_INST_TY_ARITH,
+	[0x6] = RDA_INST_TY_NEON, [0x7] = RDA_INST_TY_NEON,
+	[0x8] = RDA_INST_TY_ARITH, [0x9] = RDA_INST_TY_ARITH,
+	[0xa] = RDA_INST_TY_CONTROL, [0xb] = RDA_INST_TY_CONTROL,
+	[0xc] = RDA_INST_TY_DATA, [0xd] = RDA_INST_TY_ARITH,
+	[0xe] = RDA_INST_TY_NEON, [0xf] = RDA_INST_TY_NEON,
+};
+#endif
+
+/// @note the number of rows in internal_a64_table (checked against the table by src/tables.c).
+#define RDA_A64_TABLE_SIZE 204
+
+/**
+ * @note static table covering common aarch64 instructions.
+ *
+ *	rows are checked in order within their encoding group, so aliases
+ *	(mov, cmp, tst, mul, ...) and exact encodings come before the
+ *	general form they alias, and each group ends with a catch-all row.
+ *	vector loads/stores (v = 1) are categorized as neon, like movaps
+ *	is categorized as sse on amd64.
+ */
+#if RDA_TABLE_DEFINE
+RDA_TABLE rda_a64_int_t internal_a64_table[] = {
+	// unconditional branches (immediate).
+	{"b label",				0xfc000000, 0x14000000, RDA_INST_TY_CONTROL, RDA_INST_FL_BRANCH | RDA_INST_FL_TERM},
+	{"bl label",			0xfc000000, 0x94000000, RDA_INST_TY_CONTROL, RDA_INST_FL_BRANCH | RDA_INST_FL_CALL},
+
+	// compare and branch, test and branch, conditional branch.
+	{"cbz rt, label",		0x7f000000, 0x34000000, RDA_INST_TY_CONTROL, RDA_INST_FL_BRANCH | RDA_INST_FL_COND},
+	{"cbnz rt, label",		0x7f000000, 0x35000000, RDA_INST_TY_CONTROL, RDA_INST_FL_BRANCH | RDA_INST_FL_COND},
+	{"tbz rt, #imm, label",	0x7f000000, 0x36000000, RDA_INST_TY_CONTROL, RDA_INST_FL_BRANCH | RDA_INST_FL_COND},
+	{"tbnz rt, #imm, label",0x7f000000, 0x37000000, RDA_INST_TY_CONTROL, RDA_INST_FL_BRANCH | RDA_INST_FL_COND},
+	{"b.cond label",		0xff000010, 0x54000000, RDA_INST_TY_CONTROL, RDA_INST_FL_BRANCH | RDA_INST_FL_COND},
+
+	// unconditional branches (register), pointer authenticated forms first.
+	{"retaa",				0xffffffff, 0xd65f0bff, RDA_INST_TY_CONTROL, RDA_INST_FL_BRANCH | RDA_INST_FL_RET | RDA_INST_FL_TERM},
+	{"retab",				0xffffffff, 0xd65f0fff, RDA_INST_TY_CONTROL, RDA_INST_FL_BRANCH | RDA_INST_FL_RET | RDA_INST_FL_TERM},
+	{"ret xn",				0xfffffc1f, 0xd65f0000, RDA_INST_TY_CONTROL, RDA_INST_FL_BRANCH | RDA_INST_FL_RET | RDA_INST_FL_TERM},
+	{"braaz xn",			0xfffffc1f, 0xd61f081f, RDA_INST_TY_CONTROL, RDA_INST_FL_BRANCH | RDA_INST_FL_TERM},
+	{"blraaz xn",			0xfffffc1f, 0xd63f081f, RDA_INST_TY_CONTROL, RDA_INST_FL_BRANCH | RDA_INST_FL_CALL},
+	{"br xn",				0xfffffc1f, 0xd61f0000, RDA_INST_TY_CONTROL, RDA_INST_FL_BRANCH | RDA_INST_FL_TERM},
+	{"blr xn",				0xfffffc1f, 0xd63f0000, RDA_INST_TY_CONTROL, RDA_INST_FL_BRANCH | RDA_INST_FL_CALL},
+	{"eret",				0xffffffff, 0xd69f03e0, RDA_INST_TY_SYSTEM, RDA_INST_FL_BRANCH | RDA_INST_FL_RET | RDA_INST_FL_TERM | RDA_INST_FL_PRIV},
+
+	// exception generation.
+	{"svc #imm16",			0xffe0001f, 0xd4000001, RDA_INST_TY_SYSTEM, 0},
+	{"hvc #imm16",			0xffe0001f, 0xd4000002, RDA_INST_TY_SYSTEM, RDA_INST_FL_PRIV},
+	{"smc #imm16",			0xffe0001f, 0xd4000003, RDA_INST_TY_SYSTEM, RDA_INST_FL_PRIV},
+	{"brk #imm16",			0xffe0001f, 0xd4200000, RDA_INST_TY_SYSTEM, 0},
+	{"hlt #imm16",			0xffe0001f, 0xd4400000, RDA_INST_TY_SYSTEM, 0},
+
+	// hints (nop, yield, wfe, wfi, pointer authentication, bti).
+	{"nop",					0xffffffff, 0xd503201f, RDA_INST_TY_MISC, 0},
+	{"yield",				0xffffffff, 0xd503203f, RDA_INST_TY_MISC, 0},
+	{"wfe",					0xffffffff, 0xd503205f, RDA_INST_TY_SYSTEM, 0},
+	{"wfi",					0xffffffff, 0xd503207f, RDA_INST_TY_SYSTEM, RDA_INST_FL_PRIV},
+	{"sev",					0xffffffff, 0xd503209f, RDA_INST_TY_SYSTEM, 0},
+	{"paciasp",				0xffffffff, 0xd503233f, RDA_INST_TY_MISC, 0},
+	{"autiasp",				0xffffffff, 0xd50323bf, RDA_INST_TY_MISC, 0},
+	{"pacibsp",				0xffffffff, 0xd503237f, RDA_INST_TY_MISC, 0},
+	{"autibsp",				0xffffffff, 0xd50323ff, RDA_INST_TY_MISC, 0},
+	{"bti",					0xffffff3f, 0xd503241f, RDA_INST_TY_MISC, 0},
+	{"hint #imm",			0xfffff01f, 0xd503201f, RDA_INST_TY_MISC, 0},
+
+	// barriers and system registers.
+	{"clrex",				0xfffff0ff, 0xd503305f, RDA_INST_TY_SYSTEM, 0},
+	{"dsb option",			0xfffff0ff, 0xd503309f, RDA_INST_TY_SYSTEM, 0},
+	{"dmb option",			0xfffff0ff, 0xd50330bf, RDA_INST_TY_SYSTEM, 0},
+	{"isb",					0xfffff0ff, 0xd50330df, RDA_INST_TY_SYSTEM, 0},
+	{"msr pstatefield, #imm",0xfff8f01f, 0xd500401f, RDA_INST_TY_FLAG, 0},
+	{"sys #op1, cn, cm, #op2, xt", 0xfff80000, 0xd5080000, RDA_INST_TY_SYSTEM, 0},
+	{"msr sysreg, xt",		0xfff00000, 0xd5100000, RDA_INST_TY_SYSTEM, 0},
+	{"mrs xt, sysreg",		0xfff00000, 0xd5300000, RDA_INST_TY_SYSTEM, 0},
+
+	// pc-relative addressing.
+	{"adr xd, label",		0x9f000000, 0x10000000, RDA_INST_TY_DATA, RDA_INST_FL_RIP},
+	{"adrp xd, label",		0x9f000000, 0x90000000, RDA_INST_TY_DATA, RDA_INST_FL_RIP},
+
+	// add/subtract (immediate), aliases first.
+	{"mov rd|sp, rn|sp",	0x7ffffc00, 0x11000000, RDA_INST_TY_DATA, 0},
+	{"cmn rn|sp, #imm",		0x7f80001f, 0x3100001f, RDA_INST_TY_ARITH, 0},
+	{"cmp rn|sp, #imm",		0x7f80001f, 0x7100001f, RDA_INST_TY_ARITH, 0},
+	{"add rd|sp, rn|sp, #imm",	0x7f800000, 0x11000000, RDA_INST_TY_ARITH, 0},
+	{"adds rd, rn|sp, #imm",	0x7f800000, 0x31000000, RDA_INST_TY_ARITH, 0},
+	{"sub rd|sp, rn|sp, #imm",	0x7f800000, 0x51000000, RDA_INST_TY_ARITH, 0},
+	{"subs rd, rn|sp, #imm",	0x7f800000, 0x71000000, RDA_INST_TY_ARITH, 0},
+
+	// logical (immediate).
+	{"tst rn, #imm",		0x7f80001f, 0x7200001f, RDA_INST_TY_LOGIC, 0},
+	{"and rd|sp, rn, #imm",	0x7f800000, 0x12000000, RDA_INST_TY_LOGIC, 0},
+	{"orr rd|sp, rn, #imm",	0x7f800000, 0x32000000, RDA_INST_TY_LOGIC, 0},
+	{"eor rd|sp, rn, #imm",	0x7f800000, 0x52000000, RDA_INST_TY_LOGIC, 0},
+	{"ands rd, rn, #imm",	0x7f800000, 0x72000000, RDA_INST_TY_LOGIC, 0},
+
+	// move wide (immediate).
+	{"movn rd, #imm16",		0x7f800000, 0x12800000, RDA_INST_TY_DATA, 0},
+	{"movz rd, #imm16",		0x7f800000, 0x52800000, RDA_INST_TY_DATA, 0},
+	{"movk rd, #imm16",		0x7f800000, 0x72800000, RDA_INST_TY_DATA, 0},
+
+	// bitfield and extract (lsl, lsr, asr, sxtw, ubfx, ... are aliases).
+	{"sbfm rd, rn, #immr, #imms",	0x7f800000, 0x13000000, RDA_INST_TY_LOGIC, 0},
+	{"bfm rd, rn, #immr, #imms",	0x7f800000, 0x33000000, RDA_INST_TY_LOGIC, 0},
+	{"ubfm rd, rn, #immr, #imms",	0x7f800000, 0x53000000, RDA_INST_TY_LOGIC, 0},
+	{"extr rd, rn, rm, #lsb",		0x7fa00000, 0x13800000, RDA_INST_TY_LOGIC, 0},
+
+	// logical (shifted register), aliases first.
+	{"mov rd, rm",			0x7fe0ffe0, 0x2a0003e0, RDA_INST_TY_DATA, 0},
+	{"mvn rd, rm",			0x7f2003e0, 0x2a2003e0, RDA_INST_TY_LOGIC, 0},
+	{"tst rn, rm",			0x7f20001f, 0x6a00001f, RDA_INST_TY_LOGIC, 0},
+	{"and rd, rn, rm",		0x7f200000, 0x0a000000, RDA_INST_TY_LOGIC, 0},
+	{"bic rd, rn, rm",		0x7f200000, 0x0a200000, RDA_INST_TY_LOGIC, 0},
+	{"orr rd, rn, rm",		0x7f200000, 0x2a000000, RDA_INST_TY_LOGIC, 0},
+	{"orn rd, rn, rm",		0x7f200000, 0x2a200000, RDA_INST_TY_LOGIC, 0},
+	{"eor rd, rn, rm",		0x7f200000, 0x4a000000, RDA_INST_TY_LOGIC, 0},
+	{"eon rd, rn, rm",		0x7f200000, 0x4a200000, RDA_INST_TY_LOGIC, 0},
+	{"ands rd, rn, rm",		0x7f200000, 0x6a000000, RDA_INST_TY_LOGIC, 0},
+	{"bics rd, rn, rm",		0x7f200000, 0x6a200000, RDA_INST_TY_LOGIC, 0},
+
+	// add/subtract (shifted and extended register), aliases first.
+	{"cmn rn, rm",			0x7f20001f, 0x2b00001f, RDA_INST_TY_ARITH, 0},
+	{"cmp rn, rm",			0x7f20001f, 0x6b00001f, RDA_INST_TY_ARITH, 0},
+	{"neg rd, rm",			0x7f2003e0, 0x4b0003e0, RDA_INST_TY_ARITH, 0},
+	{"add rd, rn, rm",		0x7f200000, 0x0b000000, RDA_INST_TY_ARITH, 0},
+	{"adds rd, rn, rm",		0x7f200000, 0x2b000000, RDA_INST_TY_ARITH, 0},
+	{"sub rd, rn, rm",		0x7f200000, 0x4b000000, RDA_INST_TY_ARITH, 0},
+	{"subs rd, rn, rm",		0x7f200000, 0x6b000000, RDA_INST_TY_ARITH, 0},
+	{"add rd|sp, rn|sp, rm, extend",	0x7fe00000, 0x0b200000, RDA_INST_TY_ARITH, 0},
+	{"adds rd, rn|sp, rm, extend",		0x7fe00000, 0x2b200000, RDA_INST_TY_ARITH, 0},
+	{"sub rd|sp, rn|sp, rm, extend",	0x7fe00000, 0x4b200000, RDA_INST_TY_ARITH, 0},
+	{"subs rd, rn|sp, rm, extend",		0x7fe00000, 0x6b200000, RDA_INST_TY_ARITH, 0},
+
+	// add/subtract with carry, conditional compare and select.
+	{"adc rd, rn, rm",		0x7fe0fc00, 0x1a000000, RDA_INST_TY_ARITH, 0},
+	{"adcs rd, rn, rm",		0x7fe0fc00, 0x3a000000, RDA_INST_TY_ARITH, 0},
+	{"sbc rd, rn, rm",		0x7fe0fc00, 0x5a000000, RDA_INST_TY_ARITH, 0},
+	{"sbcs rd, rn, rm",		0x7fe0fc00, 0x7a000000, RDA_INST_TY_ARITH, 0},
+	{"ccmn rn, rm|#imm, #nzcv, cond",	0x7fe00410, 0x3a400000, RDA_INST_TY_ARITH, 0},
+	{"ccmp rn, rm|#imm, #nzcv, cond",	0x7fe00410, 0x7a400000, RDA_INST_TY_ARITH, 0},
+	{"csel rd, rn, rm, cond",	0x7fe00c00, 0x1a800000, RDA_INST_TY_DATA, 0},
+	{"csinc rd, rn, rm, cond",	0x7fe00c00, 0x1a800400, RDA_INST_TY_DATA, 0},
+	{"csinv rd, rn, rm, cond",	0x7fe00c00, 0x5a800000, RDA_INST_TY_DATA, 0},
+	{"csneg rd, rn, rm, cond",	0x7fe00c00, 0x5a800400, RDA_INST_TY_DATA, 0},
+
+	// data processing (3 source), aliases first.
+	{"mul rd, rn, rm",		0x7fe0fc00, 0x1b007c00, RDA_INST_TY_ARITH, 0},
+	{"madd rd, rn, rm, ra",	0x7fe08000, 0x1b000000, RDA_INST_TY_ARITH, 0},
+	{"msub rd, rn, rm, ra",	0x7fe08000, 0x1b008000, RDA_INST_TY_ARITH, 0},
+	{"smaddl xd, wn, wm, xa",	0xffe08000, 0x9b200000, RDA_INST_TY_ARITH, 0},
+	{"smulh xd, xn, xm",		0xffe08000, 0x9b400000, RDA_INST_TY_ARITH, 0},
+	{"umaddl xd, wn, wm, xa",	0xffe08000, 0x9ba00000, RDA_INST_TY_ARITH, 0},
+	{"umulh xd, xn, xm",		0xffe08000, 0x9bc00000, RDA_INST_TY_ARITH, 0},
+
+	// data processing (2 source and 1 source).
+	{"udiv rd, rn, rm",		0x7fe0fc00, 0x1ac00800, RDA_INST_TY_ARITH, 0},
+	{"sdiv rd, rn, rm",		0x7fe0fc00, 0x1ac00c00, RDA_INST_TY_ARITH, 0},
+	{"lslv rd, rn, rm",		0x7fe0fc00, 0x1ac02000, RDA_INST_TY_LOGIC, 0},
+	{"lsrv rd, rn, rm",		0x7fe0fc00, 0x1ac02400, RDA_INST_TY_LOGIC, 0},
+	{"asrv rd, rn, rm",		0x7fe0fc00, 0x1ac02800, RDA_INST_TY_LOGIC, 0},
+	{"rorv rd, rn, rm",		0x7fe0fc00, 0x1ac02c00, RDA_INST_TY_LOGIC, 0},
+	{"crc32 wd, wn, rm",	0x7fe0f000, 0x1ac04000, RDA_INST_TY_ARITH, 0},
+	{"rbit rd, rn",			0x7ffffc00, 0x5ac00000, RDA_INST_TY_LOGIC, 0},
+	{"rev16 rd, rn",		0x7ffffc00, 0x5ac00400, RDA_INST_TY_LOGIC, 0},
+	{"rev rd, rn",			0x7ffff800, 0x5ac00800, RDA_INST_TY_LOGIC, 0},
+	{"clz rd, rn",			0x7ffffc00, 0x5ac01000, RDA_INST_TY_LOGIC, 0},
+	{"cls rd, rn",			0x7ffffc00, 0x5ac01400, RDA_INST_TY_LOGIC, 0},
+
+	// load register (literal).
+	{"ldr rt, label",		0xbf000000, 0x18000000, RDA_INST_TY_DATA, RDA_INST_FL_READ | RDA_INST_FL_RIP},
+	{"ldrsw xt, label",		0xff000000, 0x98000000, RDA_INST_TY_DATA, RDA_INST_FL_READ | RDA_INST_FL_RIP},
+	{"prfm prfop, label",	0xff000000, 0xd8000000, RDA_INST_TY_MISC, RDA_INST_FL_RIP},
+	{"ldr vt, label",		0x3f000000, 0x1c000000, RDA_INST_TY_NEON, RDA_INST_FL_READ | RDA_INST_FL_RIP},
+
+	// load/store pair, the common prologue/epilogue forms first.
+	{"stp x, x, [sp, #imm]!",	0xffc003e0, 0xa98003e0, RDA_INST_TY_DATA, RDA_INST_FL_WRITE | RDA_INST_FL_STACK},
+	{"ldp x, x, [sp], #imm",	0xffc003e0, 0xa8c003e0, RDA_INST_TY_DATA, RDA_INST_FL_READ | RDA_INST_FL_STACK},
+	{"stp rt, rt2, [xn|sp, #imm]",	0x7e400000, 0x28000000, RDA_INST_TY_DATA, RDA_INST_FL_WRITE},
+	{"ldp rt, rt2, [xn|sp, #imm]",	0x7e400000, 0x28400000, RDA_INST_TY_DATA, RDA_INST_FL_READ},
+	{"ldpsw xt, xt2, [xn|sp, #imm]",0xfe400000, 0x68400000, RDA_INST_TY_DATA, RDA_INST_FL_READ},
+	{"stp vt, vt2, [xn|sp, #imm]",	0x3e400000, 0x2c000000, RDA_INST_TY_NEON, RDA_INST_FL_WRITE},
+	{"ldp vt, vt2, [xn|sp, #imm]",	0x3e400000, 0x2c400000, RDA_INST_TY_NEON, RDA_INST_FL_READ},
+
+	// load/store exclusive, acquire/release.
+	{"stxr ws, rt, [xn|sp]",	0xbfe0fc00, 0x88007c00, RDA_INST_TY_DATA, RDA_INST_FL_WRITE},
+	{"stlxr ws, rt, [xn|sp]",	0xbfe0fc00, 0x8800fc00, RDA_INST_TY_DATA, RDA_INST_FL_WRITE},
+	{"ldxr rt, [xn|sp]",		0xbffffc00, 0x885f7c00, RDA_INST_TY_DATA, RDA_INST_FL_READ},
+	{"ldaxr rt, [xn|sp]",		0xbffffc00, 0x885ffc00, RDA_INST_TY_DATA, RDA_INST_FL_READ},
+	{"stlr rt, [xn|sp]",		0xbffffc00, 0x889ffc00, RDA_INST_TY_DATA, RDA_INST_FL_WRITE},
+	{"ldar rt, [xn|sp]",		0xbffffc00, 0x88dffc00, RDA_INST_TY_DATA, RDA_INST_FL_READ},
+	{"cas rs, rt, [xn|sp]",		0xbfa07c00, 0x88a07c00, RDA_INST_TY_DATA, RDA_INST_FL_READ | RDA_INST_FL_WRITE},
+	{"ldst exclusive",			0x3f000000, 0x08000000, RDA_INST_TY_DATA, RDA_INST_FL_READ | RDA_INST_FL_WRITE},
+
+	// atomic memory operations (lse).
+	{"swp rs, rt, [xn|sp]",		0x3f20fc00, 0x38208000, RDA_INST_TY_DATA, RDA_INST_FL_READ | RDA_INST_FL_WRITE},
+	{"ldadd rs, rt, [xn|sp]",	0x3f20fc00, 0x38200000, RDA_INST_TY_ARITH, RDA_INST_FL_READ | RDA_INST_FL_WRITE},
+	{"ldclr rs, rt, [xn|sp]",	0x3f20fc00, 0x38201000, RDA_INST_TY_LOGIC, RDA_INST_FL_READ | RDA_INST_FL_WRITE},
+	{"ldeor rs, rt, [xn|sp]",	0x3f20fc00, 0x38202000, RDA_INST_TY_LOGIC, RDA_INST_FL_READ | RDA_INST_FL_WRITE},
+	{"ldset rs, rt, [xn|sp]",	0x3f20fc00, 0x38203000, RDA_INST_TY_LOGIC, RDA_INST_FL_READ | RDA_INST_FL_WRITE},
+
+	// load/store register (unsigned offset), 64 and 32-bit first.
+	{"ldr xt, [xn|sp, #imm]",	0xffc00000, 0xf9400000, RDA_INST_TY_DATA, RDA_INST_FL_READ},
+	{"str xt, [xn|sp, #imm]",	0xffc00000, 0xf9000000, RDA_INST_TY_DATA, RDA_INST_FL_WRITE},
+	{"ldr wt, [xn|sp, #imm]",	0xffc00000, 0xb9400000, RDA_INST_TY_DATA, RDA_INST_FL_READ},
+	{"str wt, [xn|sp, #imm]",	0xffc00000, 0xb9000000, RDA_INST_TY_DATA, RDA_INST_FL_WRITE},
+	{"ldrb wt, [xn|sp, #imm]",	0xffc00000, 0x39400000, RDA_INST_TY_DATA, RDA_INST_FL_READ},
+	{"strb wt, [xn|sp, #imm]",	0xffc00000, 0x39000000, RDA_INST_TY_DATA, RDA_INST_FL_WRITE},
+	{"ldrh wt, [xn|sp, #imm]",	0xffc00000, 0x79400000, RDA_INST_TY_DATA, RDA_INST_FL_READ},
+	{"strh wt, [xn|sp, #imm]",	0xffc00000, 0x79000000, RDA_INST_TY_DATA, RDA_INST_FL_WRITE},
+	{"ldrsw xt, [xn|sp, #imm]",	0xffc00000, 0xb9800000, RDA_INST_TY_DATA, RDA_INST_FL_READ},
+	{"ldrsb rt, [xn|sp, #imm]",	0xff800000, 0x39800000, RDA_INST_TY_DATA, RDA_INST_FL_READ},
+	{"ldrsh rt, [xn|sp, #imm]",	0xff800000, 0x79800000, RDA_INST_TY_DATA, RDA_INST_FL_READ},
+	{"prfm prfop, [xn|sp, #imm]",0xffc00000, 0xf9800000, RDA_INST_TY_MISC, 0},
+
+	// load/store register (unscaled, pre/post-indexed and register offset).
+	{"ldur xt, [xn|sp, #simm]",	0xffe00c00, 0xf8400000, RDA_INST_TY_DATA, RDA_INST_FL_READ},
+	{"stur xt, [xn|sp, #simm]",	0xffe00c00, 0xf8000000, RDA_INST_TY_DATA, RDA_INST_FL_WRITE},
+	{"ldr xt, [xn|sp], #simm",	0xffe00c00, 0xf8400400, RDA_INST_TY_DATA, RDA_INST_FL_READ},
+	{"str xt, [xn|sp], #simm",	0xffe00c00, 0xf8000400, RDA_INST_TY_DATA, RDA_INST_FL_WRITE},
+	{"ldr xt, [xn|sp, #simm]!",	0xffe00c00, 0xf8400c00, RDA_INST_TY_DATA, RDA_INST_FL_READ},
+	{"str xt, [xn|sp, #simm]!",	0xffe00c00, 0xf8000c00, RDA_INST_TY_DATA, RDA_INST_FL_WRITE},
+	{"ldr xt, [xn|sp, rm]",		0xffe00c00, 0xf8600800, RDA_INST_TY_DATA, RDA_INST_FL_READ},
+	{"str xt, [xn|sp, rm]",		0xffe00c00, 0xf8200800, RDA_INST_TY_DATA, RDA_INST_FL_WRITE},
+
+	// remaining general purpose loads/stores, by the opc field.
+	{"str rt, [xn|sp, ...]",	0x3ec00000, 0x38000000, RDA_INST_TY_DATA, RDA_INST_FL_WRITE},
+	{"ldr rt, [xn|sp, ...]",	0x3ec00000, 0x38400000, RDA_INST_TY_DATA, RDA_INST_FL_READ},
+	{"ldrs rt, [xn|sp, ...]",	0x3e800000, 0x38800000, RDA_INST_TY_DATA, RDA_INST_FL_READ},
+
+	// simd & fp loads/stores (register and structures).
+	{"str vt, [xn|sp, ...]",	0x3e400000, 0x3c000000, RDA_INST_TY_NEON, RDA_INST_FL_WRITE},
+	{"ldr vt, [xn|sp, ...]",	0x3e400000, 0x3c400000, RDA_INST_TY_NEON, RDA_INST_FL_READ},
+	{"st1 {vt.t}, [xn|sp]",		0xbf400000, 0x0c000000, RDA_INST_TY_NEON, RDA_INST_FL_WRITE}, // st1-st4, multiple structures
+	{"ld1 {vt.t}, [xn|sp]",		0xbf400000, 0x0c400000, RDA_INST_TY_NEON, RDA_INST_FL_READ}, // ld1-ld4, multiple structures
+	{"st1 {vt.t}[i], [xn|sp]",	0xbf400000, 0x0d000000, RDA_INST_TY_NEON, RDA_INST_FL_WRITE}, // single structure
+	{"ld1 {vt.t}[i], [xn|sp]",	0xbf400000, 0x0d400000, RDA_INST_TY_NEON, RDA_INST_FL_READ}, // single structure / ld1r
+
+	// scalar floating-point.
+	{"fmov rd, vn",			0x7f36fc00, 0x1e260000, RDA_INST_TY_NEON, 0}, // fmov (general)
+	{"scvtf vd, rn",		0x7f3ffc00, 0x1e220000, RDA_INST_TY_NEON, 0},
+	{"ucvtf vd, rn",		0x7f3ffc00, 0x1e230000, RDA_INST_TY_NEON, 0},
+	{"fcvtzs rd, vn",		0x7f3ffc00, 0x1e380000, RDA_INST_TY_NEON, 0},
+	{"fcvtzu rd, vn",		0x7f3ffc00, 0x1e390000, RDA_INST_TY_NEON, 0},
+	{"fmov vd, vn",			0xff3ffc00, 0x1e204000, RDA_INST_TY_NEON, 0},
+	{"fcvt vd, vn",			0xff3e7c00, 0x1e224000, RDA_INST_TY_NEON, 0},
+	{"fmul vd, vn, vm",		0xff20fc00, 0x1e200800, RDA_INST_TY_NEON, 0},
+	{"fdiv vd, vn, vm",		0xff20fc00, 0x1e201800, RDA_INST_TY_NEON, 0},
+	{"fadd vd, vn, vm",		0xff20fc00, 0x1e202800, RDA_INST_TY_NEON, 0},
+	{"fsub vd, vn, vm",		0xff20fc00, 0x1e203800, RDA_INST_TY_NEON, 0},
+	{"fcmp vn, vm",			0xff20fc07, 0x1e202000, RDA_INST_TY_NEON, 0},
+	{"fcsel vd, vn, vm, cond",	0xff200c00, 0x1e200c00, RDA_INST_TY_NEON, 0},
+	{"fmov vd, #imm",		0xff201fe0, 0x1e201000, RDA_INST_TY_NEON, 0},
+	{"fmadd vd, vn, vm, va",0xff208000, 0x1f000000, RDA_INST_TY_NEON, 0},
+	{"fmsub vd, vn, vm, va",0xff208000, 0x1f008000, RDA_INST_TY_NEON, 0},
+
+	// advanced simd.
+	{"movi vd.t, #imm",		0x9ff80400, 0x0f000400, RDA_INST_TY_NEON, 0},
+	{"dup vd.t, rn",		0xbfe0fc00, 0x0e000c00, RDA_INST_TY_NEON, 0},
+	{"umov rd, vn.t[i]",	0xbfe0fc00, 0x0e003c00, RDA_INST_TY_NEON, 0},
+	{"ins vd.t[i], rn",		0xffe0fc00, 0x4e001c00, RDA_INST_TY_NEON, 0},
+	{"and vd.t, vn.t, vm.t",0xbfe0fc00, 0x0e201c00, RDA_INST_TY_NEON, 0},
+	{"orr vd.t, vn.t, vm.t",0xbfe0fc00, 0x0ea01c00, RDA_INST_TY_NEON, 0},
+	{"eor vd.t, vn.t, vm.t",0xbfe0fc00, 0x2e201c00, RDA_INST_TY_NEON, 0},
+	{"add vd.t, vn.t, vm.t",0xbf20fc00, 0x0e208400, RDA_INST_TY_NEON, 0},
+	{"sub vd.t, vn.t, vm.t",0xbf20fc00, 0x2e208400, RDA_INST_TY_NEON, 0},
+	{"mul vd.t, vn.t, vm.t",0xbf20fc00, 0x0e209c00, RDA_INST_TY_NEON, 0},
+	{"cmeq vd.t, vn.t, vm.t",	0xbf20fc00, 0x2e208c00, RDA_INST_TY_NEON, 0},
+	{"fadd vd.t, vn.t, vm.t",	0xbfa0fc00, 0x0e20d400, RDA_INST_TY_NEON, 0},
+	{"fmul vd.t, vn.t, vm.t",	0xbfa0fc00, 0x2e20dc00, RDA_INST_TY_NEON, 0},
+	{"fmla vd.t, vn.t, vm.t",	0xbfa0fc00, 0x0e20cc00, RDA_INST_TY_NEON, 0},
+	{"simd/fp",				0x0e000000, 0x0e000000, RDA_INST_TY_NEON, 0}, // rest of the group
+
+	// scalable vector extension.
+	{"ptrue pd.t",			0xff3ffc10, 0x2518e000, RDA_INST_TY_SVE, 0},
+	{"whilelo pd.t, rn, rm",0xff20ec10, 0x25200c00, RDA_INST_TY_SVE, 0},
+	{"add zd.t, zn.t, zm.t",0xff20fc00, 0x04200000, RDA_INST_TY_SVE, 0},
+	{"ld1w {zt.s}, pg/z, [xn|sp, xm, lsl #2]",	0xffe0e000, 0xa5404000, RDA_INST_TY_SVE, RDA_INST_FL_READ},
+	{"st1w {zt.s}, pg, [xn|sp, xm, lsl #2]",	0xffe0e000, 0xe5404000, RDA_INST_TY_SVE, RDA_INST_FL_WRITE},
+	{"ld1d {zt.d}, pg/z, [xn|sp, xm, lsl #3]",	0xffe0e000, 0xa5e04000, RDA_INST_TY_SVE, RDA_INST_FL_READ},
+	{"st1d {zt.d}, pg, [xn|sp, xm, lsl #3]",	0xffe0e000, 0xe5e04000, RDA_INST_TY_SVE, RDA_INST_FL_WRITE},
+	{"sve",					0x1e000000, 0x04000000, RDA_INST_TY_SVE, 0}, // rest of the group
+
+	// permanently undefined.
+	{"udf #imm16",			0xffff0000, 0x00000000, RDA_INST_TY_MISC, RDA_INST_FL_TERM},
+};
+#endif
+#endif //LRDA_ASMARM64_H
@@ -0,0 +1,108 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file async.h
+ */
+#ifndef LRDA_ASYNC_H
+#define LRDA_ASYNC_H
+
+/*! @uses size_t */
+#include <stddef.h>
+
+/*! @uses bool, true, false */
+#include <stdbool.h>
+
+/*! @uses rda_dec_fun_t */
+#include "disas.h"
+
+/// @note the number of workers used when none is given.
+#define RDA_ASYNC_WORKERS 2
+
+/// @note the maximum number of workers of a pool.
+#define RDA_ASYNC_WORKERS_MAX 64
+
+/**
+ * @note a pool of background workers decoding functions (see async.c); only
+ *	used through the functions below.
+ */
+typedef struct rda_async rda_async_t;
+
+/**
+ * @note the pending result of a submission; duplicate submissions of the
+ *	same address share one future, which holds a reference per submission.
+ */
+typedef struct rda_future rda_future_t;
+
+/**
+ * @brief callback for a finished decode, called on a worker thread.
+ *
+ * @param address the address that was submitted.
+ * @param function the disassembled function (owned by the future), or 0x0
+ *  if the pool was destroyed before it was decoded.
+ * @param data the user data passed to the submission.
+ */
+typedef void (*rda_async_callback_t)(void* address, rda_dec_fun_t* function, void* data);
+
+/**
+ * @brief create a pool of background workers; workers decode with the
+ *  context (rda_get_context()) current at the time of every decode.
+ *
+ * @param workers the number of worker threads (0 for RDA_ASYNC_WORKERS).
+ * @return an allocated pool or 0x0 on failure.
+ */
+rda_async_t*
+rda_async_create(size_t workers);
+
+/**
+ * @brief stop and free a pool; decodes in progress finish, pending ones
+ *  complete with a 0x0 function. futures stay valid until released.
+ *
+ * @param pool the pool.
+ */
+void
+rda_async_destroy(rda_async_t* pool);
+
+/**
+ * @brief queue a function for disassembly; higher priorities are decoded
+ *  first, equal priorities in submission order. a pending submission of the
+ *  same address is joined instead (and raised to <priority> if higher).
+ *
+ * @param pool the pool.
+ * @param address the address of the function.
+ * @param priority the priority of the request.
+ * @param callback an optional callback for when it has been decoded.
+ * @param data user data passed to <callback>.
+ * @return a future to be released with rda_future_release(), or 0x0 on failure.
+ */
+rda_future_t*
+rda_async_submit(rda_async_t* pool, void* address, int priority, rda_async_callback_t callback, void* data);
+
+/**
+ * @brief check whether a future has completed, without blocking.
+ *
+ * @param future the future.
+ * @return true if rda_future_wait() would not block.
+ */
+bool
+rda_future_ready(rda_future_t* future);
+
+/**
+ * @brief block until a future has completed.
+ *
+ * @param future the future.
+ * @return the disassembled function (owned by the future), or 0x0 if the
+ *  pool was destroyed before it was decoded.
+ */
+rda_dec_fun_t*
+rda_future_wait(rda_future_t* future);
+
+/**
+ * @brief release a reference to a future; the last one frees the future and
+ *  its function.
+ *
+ * @param future the future.
+ */
+void
+rda_future_release(rda_future_t* future);
+#endif //LRDA_ASYNC_H
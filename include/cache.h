@@ -0,0 +1,163 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file cache.h
+ */
+#ifndef LRDA_CACHE_H
+#define LRDA_CACHE_H
+
+/*! @uses size_t */
+#include <stddef.h>
+
+/*! @uses bool, true, false */
+#include <stdbool.h>
+
+/*! @uses uint8_t, uint16_t, uint32_t, uint64_t */
+#include <stdint.h>
+
+/*! @uses rda_dec_fun_t */
+#include "disas.h"
+
+/// @note the magic ("RDAC") and version of the on-disk cache format.
+#define RDA_CACHE_MAGIC 0x43414452u
+#define RDA_CACHE_VERSION 2u
+
+/// @note the maximum length of an elf build-id we store.
+#define RDA_BUILD_ID_MAX 32
+
+/**
+ * @note the header of a cache file; every section is 8-byte aligned and
+ *	addressed by its offset from the start of the file, so a mapped file
+ *	is used in place without any parsing.
+ */
+typedef struct {
+	uint32_t magic, version;		// RDA_CACHE_MAGIC and RDA_CACHE_VERSION.
+	uint64_t table_hash;			// hash of the decode tables the rows refer to.
+	uint32_t build_id_length;		// length of <build_id> (0 if the module has none).
+	uint8_t build_id[RDA_BUILD_ID_MAX]; // the elf build-id of the module.
+	uint32_t function_count;		// number of rda_cache_fun_t records.
+	uint32_t instruction_count;		// number of rda_cache_int_t records.
+	uint32_t xref_count;			// number of rda_cache_xref_t records.
+	uint64_t functions, instructions, xrefs; // section offsets.
+	uint64_t file_size;				// total size of the file.
+} rda_cache_header_t;
+
+/// @note a cached function extent (sorted by <offset>).
+typedef struct {
+	uint64_t offset;				// offset of the function from the module base.
+	uint64_t hash;					// hash of the function bytes.
+	uint32_t length;				// number of bytes processed.
+	uint32_t first, count;			// instruction range in the instruction section.
+	uint32_t first_xref, xref_count;// xref range in the xref section.
+	uint32_t reserved;				// padding, always 0.
+} rda_cache_fun_t;
+
+/// @note a cached decoded instruction.
+typedef struct {
+	uint32_t offset;				// offset from the start of the function.
+	uint16_t id;					// table row id, see rda_get_row().
+	uint8_t length, prefix_count;	// instruction length and prefix count.
+	uint8_t rex_byte, vex_encoding;	// rex byte and vex encoding.
+	uint8_t valid, reserved;		// if the instruction is valid.
+	uint16_t flags;					// instance flags, see rda_int_fl_t.
+	uint16_t padding;				// padding, always 0.
+} rda_cache_int_t;
+
+/// @note an enum for the kinds of cross references stored in the cache.
+typedef enum {
+	RDA_XREF_TY_CALL = 0x1,			// relative call.
+	RDA_XREF_TY_BRANCH = 0x2,		// relative jump or conditional jump.
+	RDA_XREF_TY_DATA = 0x3,			// rip-relative memory reference.
+} rda_xref_ty_t;
+
+/// @note a cached cross reference; targets outside the module wrap around.
+typedef struct {
+	uint64_t from, to;				// offsets of the source instruction and the target.
+	uint32_t type;					// see rda_xref_ty_t.
+	uint32_t function;				// index of the function containing <from>.
+} rda_cache_xref_t;
+
+/// @note a memory mapped cache file bound to a loaded module.
+typedef struct {
+	const rda_cache_header_t* header; // the mapped header.
+	const rda_cache_fun_t* functions; // functions, in place.
+	const rda_cache_int_t* instructions; // instructions, in place.
+	const rda_cache_xref_t* xrefs;	// cross references, in place.
+	size_t base;					// runtime base address of the module.
+	void* map;						// the mapping.
+	size_t size;					// size of the mapping.
+} rda_cache_t;
+
+/**
+ * @brief get the build-id and base address of the loaded module containing <address>.
+ *
+ * @param address any address within the module.
+ * @param build_id buffer of RDA_BUILD_ID_MAX bytes for the build-id.
+ * @param length pointer to where the build-id length is written (0 if none).
+ * @param base pointer to where the module base is written.
+ * @return true if a module containing <address> was found.
+ */
+bool
+rda_get_build_id(const void* address, unsigned char* build_id, size_t* length, size_t* base);
+
+/**
+ * @brief write decoded functions of a single module to a cache file.
+ *
+ * @param path the path of the cache file.
+ * @param functions decoded functions, all within the same module.
+ * @param count the number of <functions>.
+ * @return true on success, false otherwise.
+ */
+bool
+rda_cache_write(const char* path, rda_dec_fun_t** functions, size_t count);
+
+/**
+ * @brief map a cache file and bind it to the loaded module containing <module>;
+ *  the file is rejected if the format, the decode tables or the build-id do not
+ *  match (modules without a build-id are checked via function hashes instead).
+ *
+ * @param path the path of the cache file.
+ * @param module any address within the module the cache was written for.
+ * @return an allocated cache or 0x0 if the file is missing or stale.
+ */
+rda_cache_t*
+rda_cache_open(const char* path, const void* module);
+
+/**
+ * @brief check every cached function hash against the live bytes.
+ *
+ * @param cache an open cache.
+ * @return true if all functions are unchanged.
+ */
+bool
+rda_cache_verify(const rda_cache_t* cache);
+
+/**
+ * @brief find the cached function starting at <address>.
+ *
+ * @param cache an open cache.
+ * @param address the runtime address of the function.
+ * @return the cached function or 0x0 if it is not in the cache.
+ */
+const rda_cache_fun_t*
+rda_cache_find(const rda_cache_t* cache, const void* address);
+
+/**
+ * @brief build a rda_dec_fun_t from a cached function without decoding.
+ *
+ * @param cache an open cache.
+ * @param function a cached function from <cache>.
+ * @return an allocated function, same as rda_disassemble64().
+ */
+rda_dec_fun_t*
+rda_cache_load(const rda_cache_t* cache, const rda_cache_fun_t* function);
+
+/**
+ * @brief unmap and free a cache.
+ *
+ * @param cache an open cache.
+ */
+void
+rda_cache_close(rda_cache_t* cache);
+#endif //LRDA_CACHE_H
@@ -0,0 +1,80 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file callgraph.h
+ */
+#ifndef LRDA_CALLGRAPH_H
+#define LRDA_CALLGRAPH_H
+
+/*! @uses size_t */
+#include <stddef.h>
+
+/*! @uses bool, true, false */
+#include <stdbool.h>
+
+/// @note the function budget of a call graph when none is given.
+#define RDA_CALLGRAPH_FUNCTIONS 65536
+
+/// @note the maximum number of worker threads of a call graph build.
+#define RDA_CALLGRAPH_WORKERS_MAX 64
+
+/// @note how rda_callgraph_create() expands the graph.
+typedef struct {
+	size_t max_functions;			// function budget, 0 for RDA_CALLGRAPH_FUNCTIONS.
+	size_t workers;					// worker threads, 0 for one per online cpu.
+	bool plt;						// follow plt stubs and calls through got slots to the implementation (see symtab.h).
+} rda_callgraph_policy_t;
+
+/**
+ * @note a call graph in compressed sparse row form; the call sites of
+ *	function i are [callee_offsets[i], callee_offsets[i + 1]) of <callees>
+ *	and <sites>, in address order, and the sites calling function i are
+ *	[caller_offsets[i], caller_offsets[i + 1]) of <callers>.
+ */
+typedef struct {
+	size_t count;					// number of functions.
+	size_t* addresses;				// function addresses, ordered.
+	size_t edge_count;				// number of call sites.
+	size_t* callee_offsets;			// <count> + 1 offsets into <callees> and <sites>.
+	unsigned int* callees;			// the function called by every call site.
+	size_t* sites;					// the address of every call site.
+	size_t* caller_offsets;			// <count> + 1 offsets into <callers>.
+	unsigned int* callers;			// the function containing every call site, by callee.
+	bool truncated;					// if the function budget stopped the expansion.
+} rda_callgraph_t;
+
+/**
+ * @brief build the call graph reachable from a set of root functions; every
+ *  function is disassembled exactly once, by a pool of workers expanding the
+ *  frontier in parallel. functions with a sized symbol are decoded to its end,
+ *  others like rda_disassemble64() does; call targets outside executable
+ *  segments are ignored.
+ *
+ * @param roots the root functions.
+ * @param count the number of <roots>.
+ * @param policy how to expand the graph, 0x0 for the defaults.
+ * @return an allocated graph or 0x0 on failure.
+ */
+rda_callgraph_t*
+rda_callgraph_create(void* const* roots, size_t count, const rda_callgraph_policy_t* policy);
+
+/**
+ * @brief free a call graph.
+ *
+ * @param graph the graph to be freed.
+ */
+void
+rda_callgraph_destroy(rda_callgraph_t* graph);
+
+/**
+ * @brief find a function of a call graph by address.
+ *
+ * @param graph the graph.
+ * @param address the address of the function.
+ * @param index pointer to where the index of the function is written.
+ * @return true if the function is in the graph.
+ */
+bool
+rda_callgraph_find(const rda_callgraph_t* graph, size_t address, size_t* index);
+#endif //LRDA_CALLGRAPH_H
@@ -0,0 +1,108 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file disarm64.h
+ */
+#ifndef LRDA_DISARM64_H
+#define LRDA_DISARM64_H
+
+/*! @uses size_t */
+#include <stddef.h>
+
+/*! @uses bool, true, false */
+#include <stdbool.h>
+
+/*! @uses static_assert */
+#include <assert.h>
+
+/*! @uses rda_a64_int_t */
+#include "asmarm64.h"
+
+/*! @uses rda_dec_fun_t */
+#include "disas.h"
+
+/// @note the row id of a word that matched no row in internal_a64_table.
+#define RDA_A64_ROW_NONE 0xffff
+
+// @note a structure for a simplified, decompiled instruction in aarch64.
+typedef struct {
+    rda_a64_int_t instruction;      // instruction information, see asmarm64.h
+    unsigned short id;              // the row id of <instruction> in internal_a64_table (or RDA_A64_ROW_NONE).
+    unsigned short flags;           // semantic attribute flags of this instance, see rda_int_fl_t.
+    const unsigned char* bytes;     // raw bytes read from memory.
+    unsigned int word;              // the little-endian instruction word.
+    size_t length;                  // total byte length (always 4 when decoded).
+    bool valid;                     // if the instruction is valid.
+} rda_dec_a64_int_t;
+
+/// @note typed access to a vector of rda_dec_a64_int_t (rda_a64_inst_vec_at(), ...).
+RDA_VEC_TYPED(rda_a64_inst_vec, rda_dec_a64_int_t)
+
+/// @note the inline buffer of a vector holds the first few instructions of a function.
+static_assert(RDA_VEC_SMALL / sizeof(rda_dec_a64_int_t) >= 4, "RDA_VEC_SMALL must fit 4 rda_dec_a64_int_t");
+
+/**
+ * @brief decode a single aarch64 instruction in memory.
+ *
+ * @param bytes the bytes in memory to be decoded.
+ * @param size the size of <bytes> (at least 4).
+ * @return a pointer to an allocated structure containing the information
+ *  about the decoded instruction in aarch64, or 0x0 if <size> is less than 4.
+ */
+rda_dec_a64_int_t*
+rda_decode_single_arm64(const unsigned char* bytes, size_t size);
+
+/**
+ * @brief decode consecutive aarch64 instructions into a caller provided array,
+ *  without allocating.
+ *
+ * @param bytes the bytes in memory to be decoded.
+ * @param size the size of <bytes>.
+ * @param out the array to be written to.
+ * @param max the capacity of <out>.
+ * @return the number of instructions written to <out>.
+ */
+size_t
+rda_decode_batch_arm64(const unsigned char* bytes, size_t size, rda_dec_a64_int_t* out, size_t max);
+
+/**
+ * @brief get the instruction type of decoded aarch64 instruction.
+ *
+ * @param inst a decoded instruction.
+ * @return the category/type of the instruction.
+ */
+rda_int_ty_t
+rda_get_type_arm64(const rda_dec_a64_int_t* inst);
+
+/**
+ * @brief get the semantic attribute flags of decoded aarch64 instruction.
+ *
+ * @param inst a decoded instruction.
+ * @return the rda_int_fl_t flags of the instruction (0 if invalid).
+ */
+unsigned short
+rda_get_flags_arm64(const rda_dec_a64_int_t* inst);
+
+/**
+ * @brief disassemble an aarch64 function in memory at an address, stopping
+ *  after the first return, at the first invalid word or at the end of
+ *  readable memory.
+ *
+ * @param address the address in memory to start reading from.
+ * @return a pointer to an allocated structure containing the information
+ *  about the disassembled function; its list holds rda_dec_a64_int_t.
+ */
+rda_dec_fun_t*
+rda_disassemble_arm64(void* address);
+
+/**
+ * @brief get the instruction at index within an aarch64 function.
+ *
+ * @param function a function from rda_disassemble_arm64().
+ * @param index the index within the list of instructions.
+ * @return instruction within the function at <index> or 0x0 if not found.
+ */
+rda_dec_a64_int_t*
+rda_get_instruction_at_arm64(rda_dec_fun_t* function, size_t index);
+#endif //LRDA_DISARM64_H
@@ -13,32 +13,102 @@
 /*! @uses bool, true, false */
 #include <stdbool.h>
 
-/*! @uses rda_int_t, internal_table. */
+/*! @uses static_assert */
+#include <assert.h>
+
+/*! @uses rda_int_t */
 #include "asmx64.h"
 
-/*! @uses rda_dynl_t, rda_dynl_get */
-#include "dynl.h"
+/*! @uses RDA_INT_SIMD_TABLE_SIZE */
+#include "simdx64.h"
+
+/*! @uses rda_vec_t, RDA_VEC_TYPED */
+#include "vec.h"
+
+/*! @uses rda_profile_t */
+#include "lib.h"
 
 // @note a structure for a simplified, decompiled instruction in amd64/x86_64.
 typedef struct {
-    rda_int_t instruction;          // instruction information, see asmx64.h
+    const rda_int_t* instruction;   // the table row of the instruction (a zeroed row if invalid), see asmx64.h
+    unsigned short id;              // the table row id of <instruction>, see rda_get_row().
+    unsigned short flags;           // semantic attribute flags of this instance, see rda_int_fl_t.
     const unsigned char* bytes;     // raw bytes read from memory.
     size_t length, prefix_count;    // total byte length and prefix count.
     int rex_byte, vex_encoding;     // the rex byte value (0 = ?), and vex encoding (0 = ?, 1 = vex, 2 = evex).
     bool valid;                     // if the instruction is valid.
 } rda_dec_int_t;
 
+/// @note typed access to a vector of rda_dec_int_t (rda_inst_vec_at(), ...).
+RDA_VEC_TYPED(rda_inst_vec, rda_dec_int_t)
+
+/// @note the inline buffer of a vector holds the first few instructions of a function.
+static_assert(RDA_VEC_SMALL / sizeof(rda_dec_int_t) >= 4, "RDA_VEC_SMALL must fit 4 rda_dec_int_t");
+
 /**
  * @brief decode a single instruction in memory.
  *
  * @param bytes the bytes in memory to be decoded.
- * @param size the size of <bytes> (at the most 4).
+ * @param size the size of <bytes>, clamped to the readable memory at <bytes>.
  * @return a pointer to an allocated structure containing the information
  *  about the decoded instruction in amd64.
  */
 rda_dec_int_t*
 rda_decode_single64(const unsigned char* bytes, size_t size);
 
+/// @note the number of rows a decode profile counts, internal_table then internal_simd_table.
+#define RDA_PROFILE_ROWS (RDA_INT_TABLE_SIZE + RDA_INT_SIMD_TABLE_SIZE)
+
+/**
+ * @note a decode profile, how often every table row matched during a
+ *	learning phase (rda_context_t::learn); plain data, so it can be written
+ *	to and read back from a file as is.
+ */
+struct rda_profile {
+	unsigned int rows;						// RDA_PROFILE_ROWS when it was learned, profiles of other tables are ignored.
+	unsigned int hits[RDA_PROFILE_ROWS];	// matches of every row.
+};
+
+/**
+ * @brief get the decode profile learned since the last rda_begin() with
+ *  rda_context_t::learn set; load it with rda_context_t::profile.
+ *
+ * @param profile pointer to where the profile is written.
+ */
+void
+rda_get_profile(rda_profile_t* profile);
+
+/// @note row ids of internal_simd_table are flagged with this bit.
+#define RDA_ROW_SIMD 0x8000
+
+/**
+ * @brief get the table row for a row id.
+ *
+ * @param id the row id of a decoded instruction.
+ * @return the row in internal_table/internal_simd_table or 0x0 if <id> is out of range.
+ */
+const rda_int_t*
+rda_get_row(unsigned short id);
+
+/**
+ * @brief get the row id of a mnemonic template (e.g. "call r/m64").
+ *
+ * @param mnemonic the exact mnemonic template of a row.
+ * @param id pointer to where the row id is written.
+ * @return true if a row with <mnemonic> exists.
+ */
+bool
+rda_get_row_id(const char* mnemonic, unsigned short* id);
+
+/**
+ * @brief get the semantic attribute flags of decoded instruction.
+ *
+ * @param inst a decoded instruction.
+ * @return the rda_int_fl_t flags of the instruction (0 if invalid).
+ */
+unsigned short
+rda_get_flags(const rda_dec_int_t* inst);
+
 /**
  * @brief get the instruction type of decoded instruction.
  *
@@ -48,15 +118,22 @@ rda_decode_single64(const unsigned char* bytes, size_t size);
 rda_int_ty_t
 rda_get_type(const rda_dec_int_t* inst);
 
+/// @note the granularity at which function snapshots are copied.
+#define RDA_PAGE_SIZE 4096
+
 // @note a structure for a simplified, disassembled function in amd64/x86_64.
 typedef struct {
-    rda_dynl_t* list; // a list of decoded instructions in a function.
-    unsigned char* bytes; // the actual bytes processed (trimmed).
+    rda_vec_t list; // the decoded instructions of a function, stored contiguously.
+    unsigned char* bytes; // the bytes processed; a view of live memory, or the snapshot they were decoded from.
     size_t address, length; // the address (unsigned long) and the length of bytes processed.
+    bool snapshot; // if <bytes> is an owned snapshot (see rda_context_t), rather than a view.
 } rda_dec_fun_t;
 
 /**
- * @brief disassemble a function in memory at an address.
+ * @brief disassemble a function in memory at an address; by default the
+ *  function is a zero-copy view of live memory, with rda_context_t::snapshot
+ *  the bytes are copied once up front and every instruction refers to the copy.
+ *  decoding stops at the end of readable memory.
  *
  * @param address the address in memory to start reading from.
  * @return a pointer to an allocated structure containing the information
@@ -65,6 +142,44 @@ typedef struct {
 rda_dec_fun_t*
 rda_disassemble64(void* address);
 
+/// @note conditions that end rda_disassemble_range64(), combined with |.
+typedef enum {
+	RDA_STOP_RET = 0x1,				// after a return.
+	RDA_STOP_JMP = 0x2,				// after an unconditional jump (tail calls, stubs).
+	RDA_STOP_PADDING = 0x4,			// before int3, or a nop that cannot be fallen into.
+} rda_stop_fl_t;
+
+/// @note when rda_disassemble_range64() stops, besides the byte budget and invalid instructions.
+typedef struct {
+	unsigned int stop;				// rda_stop_fl_t conditions.
+	size_t max_instructions;		// instruction budget, 0 for none.
+	size_t end;						// address decoding must not reach past, 0 for none.
+} rda_range_policy_t;
+
+/**
+ * @brief disassemble at most <max_bytes> bytes at an address, stopping at the
+ *  first invalid instruction or when <policy> says so; the decoder is never
+ *  given bytes past the budget or the end of readable memory (see memmap.h),
+ *  and an instruction that does not fit in them is not included.
+ *
+ * @param address the address in memory to start reading from.
+ * @param max_bytes the byte budget, 0 for none.
+ * @param policy the stop conditions, 0x0 to stop after a return.
+ * @return a pointer to an allocated structure containing the information
+ *  about the disassembled function in amd64.
+ */
+rda_dec_fun_t*
+rda_disassemble_range64(void* address, size_t max_bytes, const rda_range_policy_t* policy);
+
+/**
+ * @brief free a disassembled function, its instructions and its snapshot (if any).
+ *
+ * @param function a function from rda_disassemble64(), rda_disassemble_arm64()
+ *  or rda_cache_load().
+ */
+void
+rda_free_function(rda_dec_fun_t* function);
+
 /**
  * @brief get the instruction at index within a function.
  *
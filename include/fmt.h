@@ -0,0 +1,52 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file fmt.h
+ */
+#ifndef LRDA_FMT_H
+#define LRDA_FMT_H
+
+/*! @uses size_t */
+#include <stddef.h>
+
+/*! @uses rda_dec_int_t, rda_dec_fun_t */
+#include "disas.h"
+
+/// @note an enum for the assembly syntaxes supported by the formatter.
+typedef enum {
+	RDA_SYNTAX_INTEL = 0x0,	// intel syntax (mov rax, qword ptr [rbp-0x8]).
+	RDA_SYNTAX_ATT = 0x1,	// at&t syntax (mov -0x8(%rbp),%rax).
+} rda_syntax_t;
+
+/**
+ * @brief format a single decoded instruction into <buffer>, with real
+ *  registers, displacements, immediates and resolved branch targets.
+ *  this does not allocate and does not use printf; like snprintf the
+ *  output is truncated (but always null-terminated) if <size> is too small.
+ *
+ * @param inst a decoded instruction.
+ * @param address the runtime address of <inst> (used to resolve rel/rip targets).
+ * @param syntax the syntax to be used.
+ * @param buffer the buffer to be written to (may be 0x0 if <size> is 0).
+ * @param size the size of <buffer> in bytes.
+ * @return the length of the full text (excluding the null-terminator).
+ */
+size_t
+rda_format_instruction(const rda_dec_int_t* inst, size_t address, rda_syntax_t syntax,
+	char* buffer, size_t size);
+
+/**
+ * @brief format every instruction of a disassembled function into <buffer>,
+ *  one "<address>: <instruction>" line per instruction.
+ *
+ * @param function a disassembled function.
+ * @param syntax the syntax to be used.
+ * @param buffer the buffer to be written to (may be 0x0 if <size> is 0).
+ * @param size the size of <buffer> in bytes.
+ * @return the length of the full text (excluding the null-terminator); if this
+ *  is >= <size> the output was truncated.
+ */
+size_t
+rda_format_function(const rda_dec_fun_t* function, rda_syntax_t syntax, char* buffer, size_t size);
+#endif //LRDA_FMT_H
@@ -0,0 +1,123 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file fprint.h
+ */
+#ifndef LRDA_FPRINT_H
+#define LRDA_FPRINT_H
+
+/*! @uses size_t */
+#include <stddef.h>
+
+/*! @uses uint64_t, uint32_t, UINT32_MAX */
+#include <stdint.h>
+
+/*! @uses bool, true, false */
+#include <stdbool.h>
+
+/*! @uses rda_dec_fun_t */
+#include "disas.h"
+
+/// @note the number of minhash values of a sketch.
+#define RDA_FPRINT_HASHES 32
+
+/// @note the number of consecutive instructions of an opcode n-gram.
+#define RDA_FPRINT_NGRAM 3
+
+/// @note the number of lsh bands a sketch is split into (RDA_FPRINT_HASHES / RDA_FPRINT_BANDS values each).
+#define RDA_FPRINT_BANDS 8
+
+/// @note the most fingerprints a query looks at per band (or exact hash), to bound common buckets.
+#define RDA_FPRINT_BUCKET_MAX 64
+
+/**
+ * @note the fingerprint of a function. <exact> hashes the instruction stream
+ *	with operands normalized: registers are kept, displacements, immediates
+ *	and branch targets are masked. <sketch> is a minhash of the n-grams of
+ *	table rows, so two sketches agree on about as many values as the two
+ *	functions share n-grams. row ids come from the decode tables, so only
+ *	fingerprints of the same librda version can be compared.
+ */
+typedef struct {
+	uint64_t exact;					// hash of the normalized instruction stream.
+	uint32_t sketch[RDA_FPRINT_HASHES]; // minimum hash of the n-grams, per hash function.
+	uint32_t instructions;			// number of instructions.
+} rda_fprint_t;
+
+/// @note a hash and the fingerprint it belongs to.
+typedef struct {
+	uint64_t key;
+	uint32_t index;					// index of the fingerprint (as given to rda_fprint_index_create()).
+} rda_fprint_key_t;
+
+/**
+ * @note an index of fingerprints: the exact hashes, and every lsh band of
+ *	every sketch, in sorted columns searched by binary search.
+ */
+typedef struct {
+	size_t count;					// number of fingerprints.
+	rda_fprint_t* fprints;			// the fingerprints, as given.
+	rda_fprint_key_t* exact;		// <count> exact hashes, ordered by key.
+	rda_fprint_key_t* bands;		// RDA_FPRINT_BANDS columns of <count> band hashes, each ordered by key.
+} rda_fprint_index_t;
+
+/// @note a fingerprint matching a query.
+typedef struct {
+	size_t index;					// index of the fingerprint (as given to rda_fprint_index_create()).
+	double similarity;				// estimated jaccard similarity of the n-grams, 1 if <exact>.
+	bool exact;						// if the exact hashes are the same.
+} rda_fprint_match_t;
+
+/**
+ * @brief fingerprint a decoded amd64 function, up to its first invalid instruction.
+ *
+ * @param function the function.
+ * @param fprint the fingerprint to be written to.
+ * @return false if the function has no valid instruction.
+ */
+bool
+rda_fprint_compute(const rda_dec_fun_t* function, rda_fprint_t* fprint);
+
+/**
+ * @brief estimate the jaccard similarity of the n-grams of two fingerprints.
+ *
+ * @param a the first fingerprint.
+ * @param b the second fingerprint.
+ * @return the share of sketch values that are the same, in [0, 1].
+ */
+double
+rda_fprint_similarity(const rda_fprint_t* a, const rda_fprint_t* b);
+
+/**
+ * @brief build an index over fingerprints.
+ *
+ * @param fprints the fingerprints (copied).
+ * @param count the number of <fprints>.
+ * @return an allocated index or 0x0 on failure.
+ */
+rda_fprint_index_t*
+rda_fprint_index_create(const rda_fprint_t* fprints, size_t count);
+
+/**
+ * @brief free an index of fingerprints.
+ *
+ * @param index the index to be freed.
+ */
+void
+rda_fprint_index_destroy(rda_fprint_index_t* index);
+
+/**
+ * @brief find the nearest fingerprints of an index: those with the same
+ *  exact hash, then those sharing a band of their sketch, by similarity.
+ *
+ * @param index the index.
+ * @param fprint the fingerprint to look up.
+ * @param matches the matches (<max_matches> of them) to be written to, the most similar first.
+ * @param max_matches the maximum number of matches.
+ * @return the number of matches written.
+ */
+size_t
+rda_fprint_index_query(const rda_fprint_index_t* index, const rda_fprint_t* fprint,
+	rda_fprint_match_t* matches, size_t max_matches);
+#endif //LRDA_FPRINT_H
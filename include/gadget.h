@@ -0,0 +1,97 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file gadget.h
+ */
+#ifndef LRDA_GADGET_H
+#define LRDA_GADGET_H
+
+/*! @uses size_t */
+#include <stddef.h>
+
+/*! @uses rda_dec_fun_t */
+#include "disas.h"
+
+/// @note the terminators a gadget can end with, combined with |.
+typedef enum {
+	RDA_GADGET_RET = 0x1,			// ret, ret imm16 (c3, c2 iw).
+	RDA_GADGET_JMP = 0x2,			// jmp r/m64 (ff /4).
+	RDA_GADGET_CALL = 0x4,			// call r/m64 (ff /2).
+	RDA_GADGET_ALL = 0x7,
+} rda_gadget_fl_t;
+
+/// @note the byte budget of a gadget when none is given.
+#define RDA_GADGET_BYTES 16
+
+/// @note the maximum byte budget of a gadget.
+#define RDA_GADGET_BYTES_MAX 64
+
+/// @note the maximum number of worker threads of an enumeration.
+#define RDA_GADGET_WORKERS_MAX 64
+
+/// @note what rda_gadgets_create() and rda_gadgets_scan() collect.
+typedef struct {
+	unsigned int kinds;				// rda_gadget_fl_t terminators, 0 for all.
+	size_t max_bytes;				// byte budget including the terminator, 0 for RDA_GADGET_BYTES.
+	size_t max_instructions;		// instruction budget including the terminator, 0 for none.
+	size_t workers;					// worker threads, 0 for one per online cpu.
+} rda_gadget_policy_t;
+
+/**
+ * @note a gadget, a sequence of valid instructions without control flow,
+ *	ending with a terminator; decoded the same way from every address.
+ */
+typedef struct {
+	size_t address;					// runtime address of the first instance.
+	unsigned short length;			// byte length including the terminator.
+	unsigned char count;			// number of instructions including the terminator.
+	unsigned char kind;				// rda_gadget_fl_t of the terminator.
+	size_t instances;				// number of addresses with the same bytes.
+} rda_gadget_t;
+
+/// @note a deduplicated set of gadgets.
+typedef struct {
+	size_t count;					// number of <gadgets>.
+	rda_gadget_t* gadgets;			// ordered by address.
+} rda_gadget_set_t;
+
+/**
+ * @brief enumerate the gadgets in every executable segment of every loaded
+ *  module; the segments are split into chunks that are scanned in parallel.
+ *
+ * @param policy what to collect, 0x0 for the defaults.
+ * @return an allocated set or 0x0 on failure.
+ */
+rda_gadget_set_t*
+rda_gadgets_create(const rda_gadget_policy_t* policy);
+
+/**
+ * @brief enumerate the gadgets in a region of memory, on the calling thread.
+ *
+ * @param bytes the start of the region.
+ * @param size the size of the region in bytes.
+ * @param policy what to collect, 0x0 for the defaults (workers are ignored).
+ * @return an allocated set or 0x0 on failure.
+ */
+rda_gadget_set_t*
+rda_gadgets_scan(const unsigned char* bytes, size_t size, const rda_gadget_policy_t* policy);
+
+/**
+ * @brief free a set of gadgets.
+ *
+ * @param set the set to be freed.
+ */
+void
+rda_gadgets_destroy(rda_gadget_set_t* set);
+
+/**
+ * @brief disassemble a gadget.
+ *
+ * @param gadget the gadget.
+ * @return a pointer to an allocated structure containing the information
+ *  about the instructions of the gadget in amd64.
+ */
+rda_dec_fun_t*
+rda_disassemble_gadget(const rda_gadget_t* gadget);
+#endif //LRDA_GADGET_H
@@ -0,0 +1,63 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file integrity.h
+ */
+#ifndef LRDA_INTEGRITY_H
+#define LRDA_INTEGRITY_H
+
+/*! @uses size_t */
+#include <stddef.h>
+
+/*! @uses bool, true, false */
+#include <stdbool.h>
+
+/*! @uses rda_dec_int_t */
+#include "disas.h"
+
+/// @note differing byte ranges closer than this are reported as one range.
+#define RDA_INTEGRITY_GAP 16
+
+/// @note a modified instruction found by an integrity scan.
+typedef struct {
+	const char* module;				// path of the module file.
+	size_t address;					// live address of the instruction.
+	rda_dec_int_t live;				// the instruction as it is in memory.
+	rda_dec_int_t original;			// the instruction as it is in the file (only valid during the callback).
+	size_t function;				// address of the containing function, 0 if unknown.
+	const char* symbol;				// name of the containing function, 0x0 if unknown (only valid during the callback).
+} rda_patch_t;
+
+/**
+ * @brief callback for every modified instruction.
+ *
+ * @param patch the modified instruction.
+ * @param data the user data passed to the scan.
+ * @return true to keep scanning, false to stop.
+ */
+typedef bool (*rda_patch_callback_t)(const rda_patch_t* patch, void* data);
+
+/**
+ * @brief compare the executable segments of the loaded module containing
+ *  <module> against its file (with relocations applied), and decode only the
+ *  ranges that differ. relocations that depend on symbols are not verified.
+ *
+ * @param module any address within the module.
+ * @param callback the callback for every modified instruction.
+ * @param data user data passed to <callback>.
+ * @return the number of modified instructions reported.
+ */
+size_t
+rda_integrity_scan_module(const void* module, rda_patch_callback_t callback, void* data);
+
+/**
+ * @brief rda_integrity_scan_module() over every loaded module that has a file.
+ *
+ * @param callback the callback for every modified instruction.
+ * @param data user data passed to <callback>.
+ * @return the number of modified instructions reported.
+ */
+size_t
+rda_integrity_scan(rda_patch_callback_t callback, void* data);
+#endif //LRDA_INTEGRITY_H
@@ -0,0 +1,103 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file ipmap.h
+ */
+#ifndef LRDA_IPMAP_H
+#define LRDA_IPMAP_H
+
+/*! @uses size_t */
+#include <stddef.h>
+
+/*! @uses uint64_t, uint32_t */
+#include <stdint.h>
+
+/*! @uses bool, true, false */
+#include <stdbool.h>
+
+/*! @uses rda_dec_fun_t, rda_dec_int_t */
+#include "disas.h"
+
+/**
+ * @note a reverse index from instruction pointers to decoded instructions.
+ *	functions are ordered by start address; every function owns a range of
+ *	<bits> words with one bit per byte, set where an instruction starts, and
+ *	<ranks> holds the number of instructions before every word. the index
+ *	refers to the decoded functions, so they must outlive it.
+ */
+typedef struct {
+	size_t count;					// number of functions.
+	size_t* start;					// start address of every function (sorted).
+	size_t* end;					// end address of every function.
+	rda_dec_fun_t** functions;		// the function of every entry.
+	unsigned int* origin;			// index of every entry in the functions given to rda_ipmap_create().
+	size_t* words;					// first word of every function in <bits> and <ranks>.
+	uint64_t* bits;					// instruction boundary bitmaps.
+	uint32_t* ranks;				// number of instructions of the function before every word.
+} rda_ipmap_t;
+
+/// @note the instruction an instruction pointer resolved to.
+typedef struct {
+	const rda_dec_int_t* inst;		// the instruction containing the address, 0x0 if unresolved.
+	size_t function;				// index of the function (as given to rda_ipmap_create()).
+	size_t instruction;				// index of the instruction within its function.
+	size_t address;					// start address of the instruction.
+	rda_int_ty_t type;				// instruction type, RDA_INST_TY_INVALID if unresolved.
+} rda_ip_hit_t;
+
+/**
+ * @brief build a reverse index over decoded amd64 functions.
+ *
+ * @param functions decoded functions (non-overlapping).
+ * @param count the number of <functions>.
+ * @return an allocated index or 0x0 on failure.
+ */
+rda_ipmap_t*
+rda_ipmap_create(rda_dec_fun_t** functions, size_t count);
+
+/**
+ * @brief free a reverse index (not the functions it refers to).
+ *
+ * @param map the index to be freed.
+ */
+void
+rda_ipmap_destroy(rda_ipmap_t* map);
+
+/**
+ * @brief resolve a single instruction pointer with a binary search; an
+ *  address inside an instruction resolves to that instruction.
+ *
+ * @param map the index.
+ * @param ip the instruction pointer.
+ * @param hit the result to be written to.
+ * @return true if <ip> lies within an indexed function.
+ */
+bool
+rda_ipmap_lookup(const rda_ipmap_t* map, size_t ip, rda_ip_hit_t* hit);
+
+/**
+ * @brief resolve a batch of unsorted instruction pointers, one search each.
+ *
+ * @param map the index.
+ * @param ips the instruction pointers.
+ * @param count the number of <ips>.
+ * @param hits the results (<count> of them) to be written to.
+ * @return the number of resolved instruction pointers.
+ */
+size_t
+rda_ipmap_resolve(const rda_ipmap_t* map, const size_t* ips, size_t count, rda_ip_hit_t* hits);
+
+/**
+ * @brief resolve a batch of instruction pointers sorted in ascending order,
+ *  walking the functions alongside the samples instead of searching.
+ *
+ * @param map the index.
+ * @param ips the instruction pointers (sorted).
+ * @param count the number of <ips>.
+ * @param hits the results (<count> of them) to be written to.
+ * @return the number of resolved instruction pointers.
+ */
+size_t
+rda_ipmap_resolve_sorted(const rda_ipmap_t* map, const size_t* ips, size_t count, rda_ip_hit_t* hits);
+#endif //LRDA_IPMAP_H
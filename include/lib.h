@@ -10,12 +10,44 @@
 /*! @uses bool, true, false */
 #include <stdbool.h>
 
+/*! @uses rda_arena_t */
+#include "arena.h"
+
+/**
+ * @note amd64 instruction set profiles, combined with |; the decoder only
+ *	tries the simd rows of the profiles in rda_context_t::isa.
+ */
+typedef enum {
+	RDA_ISA_BASELINE = 0x0,			// general purpose instructions only.
+	RDA_ISA_SSE = 0x1,				// sse to sse4.2.
+	RDA_ISA_AVX = 0x2,				// avx and avx2 (vex).
+	RDA_ISA_AVX512 = 0x4,			// avx-512 (evex).
+	RDA_ISA_ALL = 0x7,
+} rda_isa_fl_t;
+
+/// @note a decode profile, see disas.h.
+typedef struct rda_profile rda_profile_t;
+
 /// @note a structure specific to the context provided to librda.
 typedef struct {
 	// whether to print to stdout or not.
 	bool verbose;
 	// whether to use simd instructions in decoding.
 	bool use_simd;
+	// the rda_isa_fl_t profiles decoded when <use_simd> is set, 0 for all.
+	unsigned int isa;
+	// whether disassembled functions decode from a private copy of their
+	//	bytes (a snapshot) instead of a zero-copy view of live memory.
+	bool snapshot;
+	// an arena that the instruction lists of disassembled functions are
+	//	allocated from (0x0 for the heap); see arena.h.
+	rda_arena_t* arena;
+	// whether the decoder counts how often every table row matches (a
+	//	learning phase, from zero), see rda_get_profile().
+	bool learn;
+	// a decode profile the candidate rows of every opcode are ordered by,
+	//	most frequent first (0x0 for table order); see rda_get_profile().
+	const rda_profile_t* profile;
 } rda_context_t;
 
 /**
@@ -42,4 +74,13 @@ rda_get_context();
  *	link against this function at all.
  */
 #define rda_internal __attribute__((visibility("internal")))
+
+/**
+ * @brief select the amd64 decoder specialized for the isa profiles of a
+ *	context (see disas.c), called by rda_begin().
+ *
+ * @param ctx the new context.
+ */
+rda_internal void
+rda_select_decoder(rda_context_t ctx);
 #endif //LRDA_LIB_H
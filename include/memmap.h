@@ -0,0 +1,100 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file memmap.h
+ */
+#ifndef LRDA_MEMMAP_H
+#define LRDA_MEMMAP_H
+
+/*! @uses size_t */
+#include <stddef.h>
+
+/// @note the access rights of a mapping, combined with |.
+typedef enum {
+	RDA_MAP_READ = 0x1,
+	RDA_MAP_WRITE = 0x2,
+	RDA_MAP_EXEC = 0x4,
+} rda_map_fl_t;
+
+/// @note a mapping of the address space, [start, end).
+typedef struct {
+	size_t start, end;
+	size_t reach;					// end of the readable mappings that follow without a gap (<start> if unreadable).
+	unsigned char rights;			// rda_map_fl_t.
+} rda_mapping_t;
+
+/// @note the mappings of the address space, as listed by /proc/self/maps.
+typedef struct {
+	size_t count;					// number of <mappings>.
+	rda_mapping_t* mappings;		// ordered by address, non-overlapping.
+} rda_memmap_t;
+
+/**
+ * @brief read the mappings of the address space from /proc/self/maps.
+ *
+ * @return an allocated map or 0x0 on failure.
+ */
+rda_memmap_t*
+rda_memmap_create(void);
+
+/**
+ * @brief free a map of the address space.
+ *
+ * @param map the map to be freed.
+ */
+void
+rda_memmap_destroy(rda_memmap_t* map);
+
+/**
+ * @brief get the process-wide map of the address space, read on first use and
+ *  again whenever a module was loaded or unloaded since (dl_iterate_phdr); maps
+ *  that were replaced stay valid until exit.
+ *
+ * @return the map or 0x0 on failure.
+ */
+const rda_memmap_t*
+rda_get_memmap(void);
+
+/**
+ * @brief find the mapping containing an address.
+ *
+ * @param map the map.
+ * @param address the address.
+ * @return the mapping or 0x0.
+ */
+const rda_mapping_t*
+rda_memmap_lookup(const rda_memmap_t* map, size_t address);
+
+/**
+ * @brief read the process-wide map again if a module was loaded or unloaded
+ *  since it was read (a compare of the dl_iterate_phdr counters); called once
+ *  per disassembled function, so that no read trusts the mappings of a module
+ *  that was unloaded.
+ */
+void
+rda_memmap_check(void);
+
+/**
+ * @brief start a new generation of the process-wide map, called by
+ *  rda_begin(): the map is read again if a module was loaded or unloaded, and
+ *  the next miss of rda_memmap_readable() may read it again.
+ */
+void
+rda_memmap_expire(void);
+
+/**
+ * @brief clamp a read to the readable memory at an address; a read within one
+ *  page is returned as is, others are checked against the process-wide map as
+ *  of the last rda_memmap_check(). if <address> is not readable in it, the map
+ *  is read again when a module was loaded or unloaded, or once per generation
+ *  (see rda_memmap_expire()) for memory mapped since.
+ *
+ * @param address the start of the read.
+ * @param size the number of bytes to be read.
+ * @return how many of the <size> bytes can be read without faulting, <size>
+ *  if /proc/self/maps cannot be read.
+ */
+size_t
+rda_memmap_readable(const void* address, size_t size);
+#endif //LRDA_MEMMAP_H
@@ -0,0 +1,107 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file opnd.h
+ */
+#ifndef LRDA_OPND_H
+#define LRDA_OPND_H
+
+/*! @uses size_t */
+#include <stddef.h>
+
+/*! @uses bool, true, false */
+#include <stdbool.h>
+
+/*! @uses rda_dec_int_t */
+#include "disas.h"
+
+/// @note the maximum number of operands decoded for a single instruction.
+#define RDA_OPND_MAX 4
+
+/// @note an enum for the register classes in amd64/x86_64.
+typedef enum {
+	RDA_REG_TY_NONE = 0x0,	// no register.
+	RDA_REG_TY_GPR8 = 0x1,	// 8-bit general purpose (al, cl, ..., spl, r8b, ...).
+	RDA_REG_TY_GPR8H = 0x2,	// legacy high 8-bit registers (ah, ch, dh, bh).
+	RDA_REG_TY_GPR16 = 0x3,	// 16-bit general purpose (ax, cx, ...).
+	RDA_REG_TY_GPR32 = 0x4,	// 32-bit general purpose (eax, ecx, ...).
+	RDA_REG_TY_GPR64 = 0x5,	// 64-bit general purpose (rax, rcx, ...).
+	RDA_REG_TY_MMX = 0x6,	// mmx registers (mm0-mm7).
+	RDA_REG_TY_XMM = 0x7,	// 128-bit simd registers.
+	RDA_REG_TY_YMM = 0x8,	// 256-bit simd registers.
+	RDA_REG_TY_ZMM = 0x9,	// 512-bit simd registers.
+	RDA_REG_TY_MASK = 0xa,	// avx512 opmask registers (k0-k7).
+	RDA_REG_TY_SEG = 0xb,	// segment registers (es, cs, ss, ds, fs, gs).
+	RDA_REG_TY_RIP = 0xc,	// the instruction pointer (rip-relative addressing).
+} rda_reg_ty_t;
+
+/// @note a register reference, a class and an index within that class.
+typedef struct {
+	unsigned char type;		// register class, see rda_reg_ty_t.
+	unsigned char index;	// index within the class (0-31).
+} rda_reg_t;
+
+/// @note an enum for the kinds of operands an instruction can have.
+typedef enum {
+	RDA_OPND_TY_NONE = 0x0,	// no operand.
+	RDA_OPND_TY_REG = 0x1,	// register operand.
+	RDA_OPND_TY_MEM = 0x2,	// memory operand ([base + index * scale + disp]).
+	RDA_OPND_TY_IMM = 0x3,	// immediate operand.
+	RDA_OPND_TY_REL = 0x4,	// relative branch operand (already resolved to an absolute target).
+} rda_opnd_ty_t;
+
+/// @note a structure for a single decoded operand.
+typedef struct {
+	rda_opnd_ty_t type;		// kind of operand.
+	unsigned short size;	// operand size in bits (0 if implied / unknown).
+	rda_reg_t reg;			// register (RDA_OPND_TY_REG).
+	rda_reg_t base, index;	// base and index registers (RDA_OPND_TY_MEM).
+	rda_reg_t segment;		// segment override (RDA_OPND_TY_MEM, type none if absent).
+	unsigned char scale;	// index scale (1, 2, 4, 8).
+	long long value;		// displacement (mem), immediate (imm) or absolute target (rel).
+} rda_opnd_t;
+
+/**
+ * @brief decode the operands of a decoded instruction into
+ *  <operands> using the instruction template and the raw bytes.
+ *
+ * @param inst a decoded instruction.
+ * @param address the runtime address of <inst> (used for relative targets).
+ * @param operands an array of at least RDA_OPND_MAX operands.
+ * @return the number of operands decoded (0 if <inst> is invalid).
+ */
+size_t
+rda_get_operands(const rda_dec_int_t* inst, size_t address, rda_opnd_t* operands);
+
+/**
+ * @brief get the absolute target of a relative branch/call (rel8/rel32).
+ *
+ * @param inst a decoded instruction.
+ * @param address the runtime address of <inst>.
+ * @param target pointer to where the target is written.
+ * @return true if <inst> has a relative target, false otherwise.
+ */
+bool
+rda_get_branch_target(const rda_dec_int_t* inst, size_t address, size_t* target);
+
+/**
+ * @brief get the absolute address referenced by a rip-relative memory operand.
+ *
+ * @param inst a decoded instruction.
+ * @param address the runtime address of <inst>.
+ * @param target pointer to where the referenced address is written.
+ * @return true if <inst> has a rip-relative memory operand, false otherwise.
+ */
+bool
+rda_get_rip_target(const rda_dec_int_t* inst, size_t address, size_t* target);
+
+/**
+ * @brief get the textual name of a register (without any syntax decoration).
+ *
+ * @param reg the register.
+ * @return a static string for <reg>, or "" for RDA_REG_TY_NONE.
+ */
+const char*
+rda_get_register_name(rda_reg_t reg);
+#endif //LRDA_OPND_H
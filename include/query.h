@@ -0,0 +1,137 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file query.h
+ */
+#ifndef LRDA_QUERY_H
+#define LRDA_QUERY_H
+
+/*! @uses size_t */
+#include <stddef.h>
+
+/*! @uses bool, true, false */
+#include <stdbool.h>
+
+/*! @uses USHRT_MAX */
+#include <limits.h>
+
+/*! @uses rda_dec_fun_t, rda_dec_int_t */
+#include "disas.h"
+
+/// @note the number of instruction types (rda_int_ty_t) the index keeps lists for.
+#define RDA_INDEX_TYPES (RDA_INST_TY_SVE + 1)
+
+/// @note the id of the invalid rows of an index, which no table row has (sorted after every real id).
+#define RDA_INDEX_INVALID_ID USHRT_MAX
+
+/**
+ * @note a columnar index over the instructions of many decoded functions.
+ *	every column is sorted by address; <by_type> holds, per instruction type,
+ *	the rows of that type (in address order) between type_offsets[t] and
+ *	type_offsets[t + 1], and <by_id> holds all rows ordered by (id, address).
+ *	the index refers to the decoded instructions, so the functions must
+ *	outlive it.
+ */
+typedef struct {
+	size_t count;					// number of rows (instructions).
+	size_t* address;				// runtime address of every row.
+	unsigned short* id;				// table row id (mnemonic id) of every row, RDA_INDEX_INVALID_ID if invalid.
+	unsigned short* flags;			// instance flags of every row, see rda_int_fl_t.
+	unsigned char* type;			// instruction type of every row, see rda_int_ty_t.
+	unsigned char* operands;		// bitmask of (1 << rda_opnd_ty_t) present in every row.
+	unsigned int* function;			// index of the function every row came from.
+	const rda_dec_int_t** instruction; // the decoded instruction of every row.
+	size_t type_offsets[RDA_INDEX_TYPES + 1]; // per-type ranges of <by_type>.
+	unsigned int* by_type;			// rows grouped by type.
+	unsigned int* by_id;			// rows ordered by id.
+} rda_index_t;
+
+/**
+ * @note a query; every predicate that is set must hold. the type, id and
+ *	address range predicates pick (and narrow) the lists that are walked,
+ *	the flags and operand predicates are checked on the columns.
+ */
+typedef struct {
+	unsigned int types;				// bitmask of (1u << rda_int_ty_t), 0 for any type.
+	bool match_id;					// if <id> must match.
+	unsigned short id;				// table row id, see rda_get_row_id(); RDA_INDEX_INVALID_ID for the invalid rows.
+	unsigned short flags;			// rda_int_fl_t flags that must all be set.
+	unsigned char operands;			// bitmask of (1 << rda_opnd_ty_t) that must all be present.
+	size_t start, end;				// address range [start, end), an <end> of 0 is unbounded.
+} rda_query_t;
+
+/// @note a list of rows walked by a cursor, within [position, end).
+typedef struct {
+	const unsigned int* rows;		// the rows, or 0x0 for the identity (all rows).
+	size_t position, end;			// current and end position within <rows>.
+} rda_query_stream_t;
+
+/// @note a cursor over the results of a query, in address order.
+typedef struct {
+	const rda_index_t* index;		// the index being queried.
+	rda_query_t query;				// the query.
+	rda_query_stream_t streams[RDA_INDEX_TYPES]; // the lists being merged.
+	size_t stream_count;			// number of <streams>.
+} rda_cursor_t;
+
+/**
+ * @brief callback for every result of a query.
+ *
+ * @param index the index being queried.
+ * @param row the matching row.
+ * @param data the user data passed to the query.
+ * @return true to continue, false to stop.
+ */
+typedef bool (*rda_query_callback_t)(const rda_index_t* index, size_t row, void* data);
+
+/**
+ * @brief build an index over decoded functions.
+ *
+ * @param functions decoded functions.
+ * @param count the number of <functions>.
+ * @return an allocated index or 0x0 on failure.
+ */
+rda_index_t*
+rda_index_create(rda_dec_fun_t** functions, size_t count);
+
+/**
+ * @brief free an index (not the functions it refers to).
+ *
+ * @param index the index to be freed.
+ */
+void
+rda_index_destroy(rda_index_t* index);
+
+/**
+ * @brief start a query.
+ *
+ * @param index the index to be queried.
+ * @param query the query.
+ * @param cursor the cursor to be initialized.
+ */
+void
+rda_query_begin(const rda_index_t* index, const rda_query_t* query, rda_cursor_t* cursor);
+
+/**
+ * @brief get the next result of a query.
+ *
+ * @param cursor a cursor from rda_query_begin().
+ * @param row pointer to where the matching row is written.
+ * @return true if a result was found, false if the query is exhausted.
+ */
+bool
+rda_query_next(rda_cursor_t* cursor, size_t* row);
+
+/**
+ * @brief run a query and stream every result to a callback, in address order.
+ *
+ * @param index the index to be queried.
+ * @param query the query.
+ * @param callback the callback for every result.
+ * @param data user data passed to <callback>.
+ * @return the number of results.
+ */
+size_t
+rda_query_run(const rda_index_t* index, const rda_query_t* query, rda_query_callback_t callback, void* data);
+#endif //LRDA_QUERY_H
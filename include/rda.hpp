@@ -0,0 +1,353 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file rda.hpp
+ */
+#ifndef LRDA_RDA_HPP
+#define LRDA_RDA_HPP
+
+/*! @uses std::array */
+#include <array>
+
+/*! @uses std::size_t */
+#include <cstddef>
+
+/*! @uses std::invoke, std::invoke_result_t */
+#include <functional>
+
+/*! @uses std::unique_ptr */
+#include <memory>
+
+/*! @uses std::optional */
+#include <optional>
+
+/*! @uses std::span */
+#include <span>
+
+/*! @uses std::string_view */
+#include <string_view>
+
+/*! @uses std::integral_constant, std::remove_reference_t */
+#include <type_traits>
+
+/*! @uses std::index_sequence, std::exchange */
+#include <utility>
+
+/*!
+ * @note the c interface. the instruction tables are constexpr in c++ (see
+ *	RDA_TABLE in asmx64.h), everything else is unchanged.
+ */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers" // the table rows leave their trailing simd fields out.
+extern "C" {
+#include "lib.h"
+#include "disas.h"
+#include "simdx64.h"
+#include "disarm64.h"
+#include "opnd.h"
+#include "fmt.h"
+#include "query.h"
+#include "ipmap.h"
+#include "unwind.h"
+#include "async.h"
+#include "symtab.h"
+#include "gadget.h"
+#include "callgraph.h"
+#include "memmap.h"
+#include "sampler.h"
+#include "simdscan.h"
+#include "align.h"
+#include "fprint.h"
+}
+#pragma GCC diagnostic pop
+
+namespace rda {
+
+/// @note a deleter that calls a librda destroy/free function.
+template <auto Free>
+struct deleter {
+    template <typename T>
+    void operator()(T* pointer) const noexcept { Free(pointer); }
+};
+
+/// @note owners of the objects librda allocates.
+using index = std::unique_ptr<rda_index_t, deleter<&rda_index_destroy>>;
+using ipmap = std::unique_ptr<rda_ipmap_t, deleter<&rda_ipmap_destroy>>;
+using unwind_table = std::unique_ptr<rda_unwind_table_t, deleter<&rda_unwind_destroy>>;
+using async = std::unique_ptr<rda_async_t, deleter<&rda_async_destroy>>;
+using future = std::unique_ptr<rda_future_t, deleter<&rda_future_release>>;
+using arena = std::unique_ptr<rda_arena_t, deleter<&rda_arena_destroy>>;
+using symtab = std::unique_ptr<rda_symtab_t, deleter<&rda_symtab_destroy>>;
+using gadget_set = std::unique_ptr<rda_gadget_set_t, deleter<&rda_gadgets_destroy>>;
+using callgraph = std::unique_ptr<rda_callgraph_t, deleter<&rda_callgraph_destroy>>;
+using memmap = std::unique_ptr<rda_memmap_t, deleter<&rda_memmap_destroy>>;
+using hotspots = std::unique_ptr<rda_hotspots_t, deleter<&rda_hotspots_destroy>>;
+using simd_report = std::unique_ptr<rda_simd_report_t, deleter<&rda_simd_report_destroy>>;
+using align_report = std::unique_ptr<rda_align_report_t, deleter<&rda_align_destroy>>;
+using fprint_index = std::unique_ptr<rda_fprint_index_t, deleter<&rda_fprint_index_destroy>>;
+
+/**
+ * @note an owned, disassembled function; its instructions are a contiguous
+ *	std::span (the rda_vec_t of the function), so iterating is a pointer walk.
+ */
+template <typename Inst>
+class basic_function {
+public:
+    using value_type = Inst;
+    using iterator = typename std::span<const Inst>::iterator;
+
+    basic_function() noexcept = default;
+    explicit basic_function(rda_dec_fun_t* function) noexcept : function_(function) {}
+    basic_function(basic_function&& other) noexcept : function_(std::exchange(other.function_, nullptr)) {}
+    basic_function& operator=(basic_function&& other) noexcept {
+        if (this != &other) {
+            rda_free_function(function_);
+            function_ = std::exchange(other.function_, nullptr);
+        }
+        return *this;
+    }
+    basic_function(const basic_function&) = delete;
+    basic_function& operator=(const basic_function&) = delete;
+    ~basic_function() { rda_free_function(function_); }
+
+    /// @brief the underlying function (still owned).
+    rda_dec_fun_t* get() const noexcept { return function_; }
+
+    /// @brief give up ownership of the underlying function.
+    rda_dec_fun_t* release() noexcept { return std::exchange(function_, nullptr); }
+
+    explicit operator bool() const noexcept { return function_ != nullptr; }
+
+    /// @brief the decoded instructions, in order.
+    std::span<const Inst> instructions() const noexcept {
+        if (!function_) return {};
+        const rda_vec_t& list = function_->list;
+        const void* data = list.data ? list.data : static_cast<const void*>(list.small.bytes);
+        return { static_cast<const Inst*>(data), list.length };
+    }
+
+    iterator begin() const noexcept { return instructions().begin(); }
+    iterator end() const noexcept { return instructions().end(); }
+    std::size_t size() const noexcept { return function_ ? function_->list.length : 0; }
+    const Inst& operator[](std::size_t index) const noexcept { return instructions()[index]; }
+
+    /// @brief the runtime address and the byte length of the function.
+    std::size_t address() const noexcept { return function_ ? function_->address : 0; }
+    std::size_t length() const noexcept { return function_ ? function_->length : 0; }
+
+    /// @brief the runtime address of one of its instructions (also in snapshot mode).
+    std::size_t address_of(const Inst& inst) const noexcept {
+        return function_->address + static_cast<std::size_t>(inst.bytes - function_->bytes);
+    }
+
+private:
+    rda_dec_fun_t* function_ = nullptr;
+};
+
+using function = basic_function<rda_dec_int_t>;
+using function_arm64 = basic_function<rda_dec_a64_int_t>;
+
+/// @brief see rda_disassemble64().
+inline function
+disassemble(void* address) noexcept { return function { rda_disassemble64(address) }; }
+
+/// @brief see rda_disassemble_range64().
+inline function
+disassemble_range(void* address, std::size_t max_bytes, const rda_range_policy_t& policy) noexcept {
+    return function { rda_disassemble_range64(address, max_bytes, &policy) };
+}
+
+/// @brief see rda_disassemble_arm64().
+inline function_arm64
+disassemble_arm64(void* address) noexcept { return function_arm64 { rda_disassemble_arm64(address) }; }
+
+/// @note the tag a visitor receives for an instruction type, e.g. type_tag<RDA_INST_TY_CONTROL>.
+template <rda_int_ty_t Type>
+using type_tag = std::integral_constant<rda_int_ty_t, Type>;
+
+/// @note the number of instruction types (rda_int_ty_t).
+inline constexpr std::size_t type_count = RDA_INST_TY_SVE + 1;
+
+/**
+ * @brief call a visitor with the type of an instruction as a compile-time tag,
+ *  through a jump table generated at compile time (one indirect call, no
+ *  switch); invalid instructions are visited as RDA_INST_TY_INVALID.
+ *
+ * @param visitor callable as visitor(type_tag<T>{}, inst) for every type T.
+ * @param inst a decoded instruction (amd64 or aarch64).
+ * @return what the visitor returns.
+ */
+template <typename Visitor, typename Inst>
+constexpr decltype(auto)
+visit(Visitor&& visitor, const Inst& inst) {
+    using target = std::remove_reference_t<Visitor>;
+    using result = std::invoke_result_t<target&, type_tag<RDA_INST_TY_INVALID>, const Inst&>;
+    using entry = result (*)(target&, const Inst&);
+    constexpr auto table = []<std::size_t... T>(std::index_sequence<T...>) {
+        return std::array<entry, sizeof...(T)> { +[](target& v, const Inst& i) -> result {
+            return std::invoke(v, type_tag<static_cast<rda_int_ty_t>(T)> {}, i);
+        }... };
+    }(std::make_index_sequence<type_count> {});
+
+    // an amd64 instruction refers to its table row, an aarch64 one holds it.
+    std::size_t type = 0;
+    if constexpr (std::is_pointer_v<decltype(inst.instruction)>)
+        type = inst.valid ? static_cast<std::size_t>(inst.instruction->type) : 0;
+    else
+        type = inst.valid ? static_cast<std::size_t>(inst.instruction.type) : 0;
+    return table[type < type_count ? type : 0](visitor, inst);
+}
+
+/// @brief the amd64 instruction tables (internal_table and internal_simd_table) and the aarch64 table.
+constexpr std::span<const rda_int_t> table() noexcept { return internal_table; }
+constexpr std::span<const rda_int_t> simd_table() noexcept { return internal_simd_table; }
+constexpr std::span<const rda_a64_int_t> a64_table() noexcept { return internal_a64_table; }
+
+/**
+ * @brief get the table row for a row id, see rda_get_row().
+ *
+ * @return the row or nullptr if <id> is out of range.
+ */
+constexpr const rda_int_t*
+row(unsigned short id) noexcept {
+    std::size_t index = id & ~RDA_ROW_SIMD;
+    auto rows = (id & RDA_ROW_SIMD) ? simd_table() : table();
+    return index < rows.size() ? &rows[index] : nullptr;
+}
+
+/**
+ * @brief get the row id of a mnemonic template, see rda_get_row_id(); usable
+ *  in constant expressions, e.g. constexpr auto call = *rda::row_id("call r/m64").
+ *
+ * @return the row id, or nothing if no row has <mnemonic>.
+ */
+constexpr std::optional<unsigned short>
+row_id(std::string_view mnemonic) noexcept {
+    for (std::size_t i = 0; i < table().size(); i++)
+        if (mnemonic == table()[i].mnemonic) return static_cast<unsigned short>(i);
+    for (std::size_t i = 0; i < simd_table().size(); i++)
+        if (mnemonic == simd_table()[i].mnemonic) return static_cast<unsigned short>(RDA_ROW_SIMD | i);
+    return std::nullopt;
+}
+
+/**
+ * @note the rows of internal_table the decoder considers for every opcode
+ *	byte (the first byte past the prefixes), in table order: a +r row under
+ *	each of its 8 bytes, an imm64 row under the byte after its rex.w, and none
+ *	under the vex/evex escapes (c4, c5, 62). the decoder tries the simd rows
+ *	first and may reorder the candidates by a profile (rda_context_t::profile);
+ *	built at compile time.
+ */
+struct opcode_index {
+    std::array<unsigned short, 257> first {};                       // the rows of byte b are rows[first[b]] to rows[first[b + 1] - 1].
+    std::array<unsigned short, std::size(internal_table) * 8> rows {}; // row ids.
+
+    /// @brief the row ids that can match <byte>.
+    constexpr std::span<const unsigned short> candidates(unsigned char byte) const noexcept {
+        return std::span<const unsigned short>(rows).subspan(first[byte], first[byte + 1] - first[byte]);
+    }
+};
+
+/**
+ * @brief check whether a row of internal_table can match an opcode byte, the
+ *  c++ counterpart of accepts_opcode() in src/disas.c.
+ */
+constexpr bool
+accepts_opcode(const rda_int_t& row, unsigned char byte) noexcept {
+    if (byte == 0xc4 || byte == 0xc5 || byte == 0x62)
+        return false;
+    if (RDA_INT_MANDATORY(row))
+        return byte == row.bytes[1];
+    if (row.plus_reg && row.opcode_length == 1) {
+        if (RDA_INT_REX_W(row))
+            return byte == row.bytes[1];
+        return (byte & 0xf8) == (row.bytes[0] & 0xf8);
+    }
+    return byte == row.bytes[0];
+}
+
+/// @brief build an opcode_index, the candidates of every byte in table order.
+consteval opcode_index
+make_opcode_index() {
+    opcode_index index;
+    std::size_t count = 0;
+    for (std::size_t b = 0; b < 256; b++) {
+        index.first[b] = static_cast<unsigned short>(count);
+        for (std::size_t i = 0; i < table().size(); i++)
+            if (accepts_opcode(table()[i], static_cast<unsigned char>(b)))
+                index.rows[count++] = static_cast<unsigned short>(i);
+    }
+    index.first[256] = static_cast<unsigned short>(count);
+    return index;
+}
+
+/// @note the opcode index of internal_table, no startup cost.
+inline constexpr opcode_index opcodes = make_opcode_index();
+
+/// @brief check whether a row is a candidate of an opcode byte in rda::opcodes.
+consteval bool
+is_candidate(std::string_view mnemonic, unsigned char byte) {
+    auto id = row_id(mnemonic);
+    for (unsigned short i : opcodes.candidates(byte))
+        if (id && i == *id) return true;
+    return false;
+}
+
+/**
+ * @brief check that every row is a candidate of one byte (8 for a +r row, none
+ *  for les and lds, whose c4/c5 start a vex prefix in 64-bit mode), in table order.
+ */
+consteval bool
+check_opcodes() {
+    std::array<std::size_t, std::size(internal_table)> seen {};
+    for (std::size_t b = 0; b < 256; b++) {
+        auto rows = opcodes.candidates(static_cast<unsigned char>(b));
+        for (std::size_t k = 0; k < rows.size(); k++) {
+            if (k > 0 && rows[k - 1] >= rows[k]) return false;
+            seen[rows[k]]++;
+        }
+    }
+    for (std::size_t i = 0; i < seen.size(); i++) {
+        const rda_int_t& row = table()[i];
+        bool second = RDA_INT_REX_W(row) || RDA_INT_MANDATORY(row);
+        bool plus_reg = row.plus_reg && row.opcode_length == 1 && !second;
+        unsigned char byte = row.bytes[second ? 1 : 0];
+        bool escape = byte == 0xc4 || byte == 0xc5 || byte == 0x62;
+        if (seen[i] != (escape ? 0u : plus_reg ? 8u : 1u)) return false;
+    }
+    return true;
+}
+
+// the candidates the decoder (build_decoder() in src/disas.c) gives an opcode
+//  byte, a change to its rules that rda::opcodes does not follow fails here.
+static_assert(std::size(internal_table) == RDA_INT_TABLE_SIZE && std::size(internal_simd_table) == RDA_INT_SIMD_TABLE_SIZE,
+    "the c++ tables must have the rows the decoder indexes");
+static_assert(opcodes.first[256] <= opcodes.rows.size(), "the candidates must fit in the index");
+static_assert(opcodes.candidates(0xc4).empty() && opcodes.candidates(0xc5).empty() && opcodes.candidates(0x62).empty(),
+    "the vex/evex escapes have no internal_table candidates");
+static_assert(is_candidate("mov rax, imm64", 0xb8) && !is_candidate("mov rax, imm64", 0x48),
+    "an imm64 row is a candidate of the byte after its rex.w");
+static_assert(is_candidate("push r64", 0x50) && is_candidate("push r64", 0x57) && !is_candidate("push r64", 0x58),
+    "a +r row is a candidate of the 8 bytes of its register");
+static_assert(is_candidate("mov r/m8, r8", 0x88), "a row is a candidate of its first opcode byte");
+static_assert(check_opcodes(), "every row is a candidate of one byte (8 for a +r row, none for an escape), in table order");
+
+/**
+ * @brief the kind of a prefix byte, the c++ counterpart of internal_prefix_table.
+ *
+ * @return 1 for legacy prefixes, 2 for rex, 0 otherwise.
+ */
+constexpr unsigned char
+prefix_kind(unsigned char byte) noexcept {
+    switch (byte) {
+        case 0x26: case 0x2e: case 0x36: case 0x3e: case 0x64: case 0x65:
+        case 0x66: case 0x67: case 0xf0: case 0xf2: case 0xf3:
+            return 1;
+        default:
+            return (byte & 0xf0) == 0x40 ? 2 : 0;
+    }
+}
+
+} // namespace rda
+#endif //LRDA_RDA_HPP
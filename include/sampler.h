@@ -0,0 +1,107 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file sampler.h
+ */
+#ifndef LRDA_SAMPLER_H
+#define LRDA_SAMPLER_H
+
+/*! @uses size_t */
+#include <stddef.h>
+
+/*! @uses bool, true, false */
+#include <stdbool.h>
+
+/*! @uses rda_dec_fun_t, rda_dec_int_t, rda_int_ty_t */
+#include "disas.h"
+
+/*! @uses rda_symbol_t */
+#include "symtab.h"
+
+/// @note the sampling frequency when none is given, in samples per second of cpu time.
+#define RDA_SAMPLER_FREQUENCY 1000
+
+/// @note the number of samples a thread can hold between two drains when none is given.
+#define RDA_SAMPLER_RING 4096
+
+/// @note the number of threads sampled when none is given.
+#define RDA_SAMPLER_THREADS 64
+
+/// @note the maximum number of threads sampled.
+#define RDA_SAMPLER_THREADS_MAX 1024
+
+/// @note how rda_sampler_start() samples.
+typedef struct {
+	unsigned int frequency;			// samples per second of cpu time, 0 for RDA_SAMPLER_FREQUENCY.
+	size_t ring;					// samples per thread ring (rounded up to a power of 2), 0 for RDA_SAMPLER_RING.
+	size_t threads;					// threads sampled, the first to be interrupted, 0 for RDA_SAMPLER_THREADS.
+} rda_sampler_policy_t;
+
+/// @note the samples of a function.
+typedef struct {
+	const rda_symbol_t* symbol;		// the function (owned by the process-wide symbol table).
+	rda_dec_fun_t* function;		// the function, decoded up to its end, its first invalid instruction or a sampled function nested in it.
+	size_t samples;
+} rda_hot_function_t;
+
+/// @note the samples of an instruction.
+typedef struct {
+	size_t address;					// runtime address of the instruction.
+	size_t function;				// index of the function in rda_hotspots_t::functions.
+	const rda_dec_int_t* inst;		// the instruction (owned by the function).
+	size_t samples;
+} rda_hot_instruction_t;
+
+/**
+ * @note the hot spots of the samples taken by the sampler, by function, by
+ *	instruction and by instruction type; functions and instructions are
+ *	ordered by samples, the most sampled first.
+ */
+typedef struct {
+	size_t samples;					// number of samples.
+	size_t dropped;					// samples lost to full rings or threads past the budget.
+	size_t unresolved;				// samples outside every sized function symbol.
+	size_t function_count;			// number of <functions>.
+	rda_hot_function_t* functions;
+	size_t instruction_count;		// number of <instructions>.
+	rda_hot_instruction_t* instructions;
+	size_t types[RDA_INST_TY_SVE + 1]; // samples by rda_int_ty_t, RDA_INST_TY_INVALID past the decoded part of a function.
+} rda_hotspots_t;
+
+/**
+ * @brief start sampling the instruction pointer of the running threads, with
+ *  setitimer(ITIMER_PROF) and a SIGPROF handler that pushes every sample into
+ *  a lock-free ring of the interrupted thread; one sampler runs per process,
+ *  and the timer and handler are not shared with other profilers.
+ *
+ * @param policy how to sample, 0x0 for the defaults.
+ * @return true if the sampler was started.
+ */
+bool
+rda_sampler_start(const rda_sampler_policy_t* policy);
+
+/**
+ * @brief stop sampling; the samples taken are kept for rda_hotspots_create().
+ */
+void
+rda_sampler_stop(void);
+
+/**
+ * @brief take the samples collected so far (the sampler may be running) and
+ *  attribute them to functions through the process-wide symbol table, and to
+ *  instructions and types by decoding every sampled function once.
+ *
+ * @return an allocated report or 0x0 on failure.
+ */
+rda_hotspots_t*
+rda_hotspots_create(void);
+
+/**
+ * @brief free a report and the functions it decoded.
+ *
+ * @param hotspots the report to be freed.
+ */
+void
+rda_hotspots_destroy(rda_hotspots_t* hotspots);
+#endif //LRDA_SAMPLER_H
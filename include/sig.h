@@ -0,0 +1,87 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file sig.h
+ */
+#ifndef LRDA_SIG_H
+#define LRDA_SIG_H
+
+/*! @uses size_t */
+#include <stddef.h>
+
+/*! @uses bool, true, false */
+#include <stdbool.h>
+
+/// @note the maximum length of a signature in bytes.
+#define RDA_SIG_MAX 64
+
+/**
+ * @note a compiled byte signature (array of bytes); a byte matches when
+ *	(byte & mask[i]) == value[i], so wildcard bytes have a mask of 0x00 and
+ *	wildcard nibbles a mask of 0x0f or 0xf0.
+ */
+typedef struct {
+	unsigned char value[RDA_SIG_MAX];	// expected value of every byte (masked).
+	unsigned char mask[RDA_SIG_MAX];	// bits of every byte that must match.
+	size_t length;						// length of the signature in bytes.
+	size_t anchor;						// offset of the fully known byte(s) used to find candidates.
+	bool pair;							// if the anchor is two consecutive known bytes.
+} rda_sig_t;
+
+/**
+ * @brief callback for every match of a scan.
+ *
+ * @param index the index of the matching signature.
+ * @param match the address of the match.
+ * @param data the user data passed to the scan.
+ * @return true to keep scanning, false to stop.
+ */
+typedef bool (*rda_sig_callback_t)(size_t index, const unsigned char* match, void* data);
+
+/**
+ * @brief compile a signature in the form "48 8b 05 ?? ?? ?? ?? 48 85 c0";
+ *  "?" and "??" are wildcard bytes, "4?" and "?8" are wildcard nibbles.
+ *
+ * @param pattern the signature text.
+ * @param sig the compiled signature to be written to.
+ * @return true on success, false if <pattern> is malformed, longer than
+ *  RDA_SIG_MAX bytes or has no fully known byte.
+ */
+bool
+rda_sig_compile(const char* pattern, rda_sig_t* sig);
+
+/**
+ * @brief scan a region of memory for many signatures in a single pass; every
+ *  block of the region is loaded once and tested against all signatures.
+ *  matches are reported block by block, so they are only roughly ordered.
+ *
+ * @param bytes the start of the region.
+ * @param size the size of the region in bytes.
+ * @param sigs the compiled signatures.
+ * @param count the number of <sigs>.
+ * @param boundary if true, only report matches that start on an instruction
+ *  boundary of a linear decode from <bytes>.
+ * @param callback the callback for every match.
+ * @param data user data passed to <callback>.
+ * @return the number of matches reported.
+ */
+size_t
+rda_sig_scan(const unsigned char* bytes, size_t size, const rda_sig_t* sigs, size_t count,
+	bool boundary, rda_sig_callback_t callback, void* data);
+
+/**
+ * @brief scan every executable segment of the loaded module containing <module>.
+ *
+ * @param module any address within the module.
+ * @param sigs the compiled signatures.
+ * @param count the number of <sigs>.
+ * @param boundary see rda_sig_scan().
+ * @param callback the callback for every match.
+ * @param data user data passed to <callback>.
+ * @return the number of matches reported.
+ */
+size_t
+rda_sig_scan_module(const void* module, const rda_sig_t* sigs, size_t count,
+	bool boundary, rda_sig_callback_t callback, void* data);
+#endif //LRDA_SIG_H
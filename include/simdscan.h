@@ -0,0 +1,106 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file simdscan.h
+ */
+#ifndef LRDA_SIMDSCAN_H
+#define LRDA_SIMDSCAN_H
+
+/*! @uses size_t */
+#include <stddef.h>
+
+/*! @uses bool, true, false */
+#include <stdbool.h>
+
+/*! @uses rda_dec_fun_t, rda_int_ty_t */
+#include "disas.h"
+
+/*! @uses rda_symbol_t */
+#include "symtab.h"
+
+/// @note the number of functions a worker claims at once when none is given.
+#define RDA_SIMD_BATCH 256
+
+/// @note the maximum number of worker threads of a sweep.
+#define RDA_SIMD_WORKERS_MAX 64
+
+/// @note what the simd usage of a function shows, combined with |.
+typedef enum {
+	RDA_SIMD_FL_256 = 0x1,			// 256-bit operations.
+	RDA_SIMD_FL_512 = 0x2,			// 512-bit operations, which lower the core frequency (avx-512 license).
+	RDA_SIMD_FL_TRANSITION = 0x4,	// legacy sse after 256/512-bit vex/evex without vzeroupper in between.
+	RDA_SIMD_FL_DIRTY_EXIT = 0x8,	// a call, return or jump out with the upper halves dirty.
+	RDA_SIMD_FL_GENERIC = 0x10,		// vex/evex instructions known by their width only (see <generic>).
+	RDA_SIMD_FL_UNDECODED = 0x20,	// decoding stopped at a vex/evex instruction it could not decode.
+} rda_simd_fl_t;
+
+/**
+ * @note the simd usage of a function; the upper state is followed in address
+ *	order, dirtied by 256/512-bit vex/evex operations and cleared by
+ *	vzeroupper/vzeroall, so the transitions are those of a linear sweep.
+ *	the decode tables name only some vex/evex encodings; the others decode
+ *	to generic rows (see RDA_INT_SIMD_VECTOR_ROWS) whose width is read from
+ *	vex.l / evex.l'l, so widths are exact but <types> counts them as avx or
+ *	avx512 whatever their operation.
+ */
+typedef struct {
+	const rda_symbol_t* symbol;		// the function, 0x0 for rda_simd_analyze() (owned by the process-wide symbol table).
+	size_t instructions;			// number of decoded instructions.
+	size_t types[RDA_INST_TY_SVE + 1]; // instructions by rda_int_ty_t.
+	size_t ops_256, ops_512;		// simd operations by width (rda_int_t::simd_size).
+	size_t transitions;				// legacy sse instructions with the upper halves dirty.
+	size_t dirty_exits;				// calls, returns and jumps out with the upper halves dirty.
+	size_t generic;					// vex/evex instructions decoded from their prefix alone.
+	size_t stop;					// offset of the first invalid instruction, if not <complete>.
+	unsigned int flags;				// rda_simd_fl_t.
+	bool complete;					// if the function was decoded to its end (no invalid instruction).
+} rda_simd_usage_t;
+
+/// @note how rda_simd_sweep() runs.
+typedef struct {
+	size_t workers;					// worker threads, 0 for one per online cpu.
+	size_t batch;					// functions per claim, 0 for RDA_SIMD_BATCH.
+	bool all;						// report functions without simd instructions as well.
+} rda_simd_policy_t;
+
+/// @note the simd usage of every function of every loaded module.
+typedef struct {
+	size_t scanned;					// number of functions decoded.
+	size_t count;					// number of <functions>.
+	rda_simd_usage_t* functions;	// ordered by address.
+	size_t types[RDA_INST_TY_SVE + 1]; // instructions by rda_int_ty_t, over every scanned function.
+	size_t ops_256, ops_512;		// simd operations by width, over every scanned function.
+	size_t generic;					// vex/evex instructions decoded from their prefix alone, over every scanned function.
+	size_t undecoded;				// scanned functions with RDA_SIMD_FL_UNDECODED.
+} rda_simd_report_t;
+
+/**
+ * @brief analyze the simd usage of a decoded amd64 function.
+ *
+ * @param function the function.
+ * @param usage the usage to be written to.
+ */
+void
+rda_simd_analyze(const rda_dec_fun_t* function, rda_simd_usage_t* usage);
+
+/**
+ * @brief sweep the sized functions of the process-wide symbol table (every
+ *  loaded module) for simd usage; batches of functions are decoded in place
+ *  by a pool of workers. simd rows are only decoded with
+ *  rda_context_t::use_simd.
+ *
+ * @param policy how to sweep, 0x0 for the defaults.
+ * @return an allocated report or 0x0 on failure.
+ */
+rda_simd_report_t*
+rda_simd_sweep(const rda_simd_policy_t* policy);
+
+/**
+ * @brief free a simd usage report.
+ *
+ * @param report the report to be freed.
+ */
+void
+rda_simd_report_destroy(rda_simd_report_t* report);
+#endif //LRDA_SIMDSCAN_H
@@ -0,0 +1,152 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file symtab.h
+ */
+#ifndef LRDA_SYMTAB_H
+#define LRDA_SYMTAB_H
+
+/*! @uses size_t */
+#include <stddef.h>
+
+/*! @uses bool, true, false */
+#include <stdbool.h>
+
+/*! @uses rda_dec_int_t, rda_dec_fun_t */
+#include "disas.h"
+
+/// @note a function or object symbol of a loaded module.
+typedef struct {
+	size_t address;					// runtime address.
+	size_t size;					// size in bytes, 0 if unknown.
+	const char* name;				// the name (owned by the table).
+	const char* module;				// path of the module (owned by the table).
+	unsigned char type;				// STT_FUNC, STT_GNU_IFUNC (<address> is the resolver) or STT_OBJECT.
+	bool global;					// if the binding is global or weak.
+} rda_symbol_t;
+
+/// @note a .plt, .plt.sec or .plt.got stub and the got slot it jumps through.
+typedef struct {
+	size_t address, end;			// the stub, [address, end).
+	size_t slot;					// runtime address of the got slot.
+	const char* name;				// the symbol the slot is bound to (owned by the table).
+} rda_plt_stub_t;
+
+/**
+ * @note the symbols of every loaded module: an address ordered interval
+ *	array, a name hash, and the plt stubs of every module.
+ */
+typedef struct {
+	size_t count;					// number of <symbols>.
+	rda_symbol_t* symbols;			// ordered by address, the preferred name first among aliases.
+	size_t* parents;				// parents[i] is the nearest earlier symbol containing symbols[i] (SIZE_MAX if none).
+	unsigned int* names;			// open addressing name hash of symbol index + 1 (0 is empty).
+	size_t name_mask;				// number of <names> buckets - 1.
+	size_t stub_count;				// number of <stubs>.
+	rda_plt_stub_t* stubs;			// ordered by address.
+	char* strings;					// the names and module paths.
+} rda_symtab_t;
+
+/// @note a resolved branch target, see rda_symtab_target().
+typedef struct {
+	size_t target;					// the branch target.
+	size_t resolved;				// the target after following a plt stub (<target> otherwise).
+	const rda_plt_stub_t* stub;		// the stub <target> is in, 0x0 if none.
+	const rda_symbol_t* symbol;		// the symbol containing <resolved>, 0x0 if none.
+	size_t offset;					// <resolved> - symbol->address.
+} rda_target_t;
+
+/**
+ * @brief build a symbol table of every loaded module; symbols are read from
+ *  .symtab (or .dynsym) of the module file, and from the dynamic section in
+ *  memory (sized through DT_GNU_HASH) for modules without one, like the vdso.
+ *
+ * @return an allocated table or 0x0 on failure.
+ */
+rda_symtab_t*
+rda_symtab_create(void);
+
+/**
+ * @brief free a symbol table.
+ *
+ * @param table the table to be freed.
+ */
+void
+rda_symtab_destroy(rda_symtab_t* table);
+
+/**
+ * @brief get the process-wide symbol table, built on first use; modules
+ *  loaded after that are not covered.
+ *
+ * @return the table or 0x0 on failure.
+ */
+const rda_symtab_t*
+rda_get_symtab(void);
+
+/**
+ * @brief find the symbol containing an address, the one starting nearest to
+ *  it if several do (e.g. a function inside a sized section symbol).
+ *
+ * @param table the table.
+ * @param address the address.
+ * @return the symbol or 0x0.
+ */
+const rda_symbol_t*
+rda_symtab_lookup(const rda_symtab_t* table, size_t address);
+
+/**
+ * @brief find a symbol by name; global definitions win over local ones, and
+ *  earlier modules (in load order) over later ones.
+ *
+ * @param table the table.
+ * @param name the name.
+ * @return the symbol or 0x0.
+ */
+const rda_symbol_t*
+rda_symtab_find(const rda_symtab_t* table, const char* name);
+
+/**
+ * @brief find the plt stub containing an address.
+ *
+ * @param table the table.
+ * @param address the address.
+ * @return the stub or 0x0.
+ */
+const rda_plt_stub_t*
+rda_symtab_stub(const rda_symtab_t* table, size_t address);
+
+/**
+ * @brief follow a plt stub to the implementation it jumps to (through its got
+ *  slot, or by name while the slot is not bound yet).
+ *
+ * @param table the table.
+ * @param address an address, possibly of a stub.
+ * @return the implementation, or <address> if it is not a stub.
+ */
+size_t
+rda_symtab_resolve(const rda_symtab_t* table, size_t address);
+
+/**
+ * @brief resolve the branch target of an instruction to a symbol.
+ *
+ * @param table the table.
+ * @param inst a decoded instruction.
+ * @param address the runtime address of <inst>.
+ * @param target pointer to where the target is written.
+ * @return false if <inst> has no direct (or rip-relative indirect) target.
+ */
+bool
+rda_symtab_target(const rda_symtab_t* table, const rda_dec_int_t* inst, size_t address, rda_target_t* target);
+
+/**
+ * @brief disassemble a function by name, exactly its symbol's bytes when the
+ *  size is known (see rda_disassemble_range64()).
+ *
+ * @param name the name of the function.
+ * @return a pointer to an allocated structure containing the information
+ *  about the disassembled function in amd64, 0x0 if there is no such function.
+ */
+rda_dec_fun_t*
+rda_disassemble_symbol(const char* name);
+#endif //LRDA_SYMTAB_H
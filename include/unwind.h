@@ -0,0 +1,122 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file unwind.h
+ */
+#ifndef LRDA_UNWIND_H
+#define LRDA_UNWIND_H
+
+/*! @uses size_t */
+#include <stddef.h>
+
+/*! @uses int16_t, int32_t, uint8_t, uint32_t */
+#include <stdint.h>
+
+/*! @uses bool, true, false */
+#include <stdbool.h>
+
+/*! @uses rda_dec_fun_t */
+#include "disas.h"
+
+/// @note the register a canonical frame address (cfa) is computed from.
+typedef enum {
+	RDA_UNWIND_UNKNOWN = 0x0,		// the frame cannot be unwound here.
+	RDA_UNWIND_RSP = 0x1,			// cfa = rsp + offset.
+	RDA_UNWIND_RBP = 0x2,			// cfa = rbp + offset.
+} rda_unwind_base_t;
+
+/// @note where the rule of an instruction came from.
+typedef enum {
+	RDA_UNWIND_DECODED = 0x0,		// tracked from the decoded prologue/epilogue instructions.
+	RDA_UNWIND_EH_FRAME = 0x1,		// the call frame information (.eh_frame) of the module.
+} rda_unwind_source_t;
+
+/**
+ * @note how to find the caller's frame from a range of instructions: the
+ *	return address is at cfa - 8, the caller's rsp is the cfa, and its rbp is
+ *	at cfa + <rbp> (or still in rbp if <rbp> is 0).
+ */
+typedef struct {
+	uint32_t offset;				// offset in the function where the rule starts.
+	int32_t cfa;					// offset added to the base register.
+	uint8_t base;					// rda_unwind_base_t.
+	uint8_t source;					// rda_unwind_source_t.
+	int16_t rbp;					// offset of the saved rbp from the cfa, 0 if not saved.
+} rda_unwind_rule_t;
+
+/**
+ * @note unwind rules for many functions, ordered by start address; the
+ *	rules of function i are rules[first[i]] to rules[first[i + 1] - 1].
+ *	the table is self-contained and can be used from a signal handler.
+ */
+typedef struct {
+	size_t count;					// number of functions.
+	size_t* start;					// start address of every function (sorted).
+	size_t* end;					// end address of every function.
+	uint32_t* first;				// first rule of every function (count + 1 entries).
+	rda_unwind_rule_t* rules;		// the rules of all functions.
+	size_t rule_count;				// number of <rules>.
+} rda_unwind_table_t;
+
+/// @note the registers of a frame that are needed to unwind it.
+typedef struct {
+	size_t ip, sp, bp;				// instruction, stack and frame pointer.
+} rda_frame_t;
+
+/**
+ * @brief build unwind rules for decoded amd64 functions; the sp delta of every
+ *  instruction is tracked from push, pop, sub/add rsp, lea, mov rbp/rsp,
+ *  leave and enter along the control flow, and instructions it cannot model
+ *  (or does not reach) take their rule from .eh_frame.
+ *
+ * @param functions decoded functions (non-overlapping, whole functions).
+ * @param count the number of <functions>.
+ * @return an allocated table or 0x0 on failure.
+ */
+rda_unwind_table_t*
+rda_unwind_create(rda_dec_fun_t** functions, size_t count);
+
+/**
+ * @brief free an unwind table.
+ *
+ * @param table the table to be freed.
+ */
+void
+rda_unwind_destroy(rda_unwind_table_t* table);
+
+/**
+ * @brief find the unwind rule of an instruction pointer.
+ *
+ * @param table the table.
+ * @param ip the instruction pointer.
+ * @return the rule or 0x0 if <ip> is not covered.
+ */
+const rda_unwind_rule_t*
+rda_unwind_find(const rda_unwind_table_t* table, size_t ip);
+
+/**
+ * @brief step from a frame to its caller. the stack is read without checks,
+ *  so <frame> must come from a live thread stack.
+ *
+ * @param table the table.
+ * @param frame the frame, replaced by its caller's.
+ * @param caller true if <frame> is a caller frame (its ip is a return
+ *  address), false for the interrupted frame.
+ * @return false if the frame cannot be unwound.
+ */
+bool
+rda_unwind_step(const rda_unwind_table_t* table, rda_frame_t* frame, bool caller);
+
+/**
+ * @brief unwind a stack from an interrupted frame, one lookup per frame.
+ *
+ * @param table the table.
+ * @param frame the interrupted frame.
+ * @param ips the return addresses to be written to, starting with frame.ip.
+ * @param max the capacity of <ips>.
+ * @return the number of addresses written.
+ */
+size_t
+rda_unwind(const rda_unwind_table_t* table, rda_frame_t frame, size_t* ips, size_t max);
+#endif //LRDA_UNWIND_H
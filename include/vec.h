@@ -0,0 +1,116 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file vec.h
+ */
+#ifndef LRDA_VEC_H
+#define LRDA_VEC_H
+
+/*! @uses size_t, max_align_t */
+#include <stddef.h>
+
+/*! @uses bool, true, false */
+#include <stdbool.h>
+
+/*! @uses rda_arena_t */
+#include "arena.h"
+
+/**
+ * @note the size of the inline buffer of every vector, in bytes; room for a
+ *	few decoded instructions (see disas.h and disarm64.h), so the instruction
+ *	list of a short function does not allocate.
+ */
+#define RDA_VEC_SMALL 256
+
+/**
+ * @note a vector of elements stored inline and contiguously. short vectors
+ *	(up to RDA_VEC_SMALL bytes) live in <small> and never allocate, longer ones
+ *	grow geometrically on the heap, or in <arena> if one is set (arena memory
+ *	is only released with the arena). use a typed view (RDA_VEC_TYPED) to
+ *	access the elements.
+ */
+typedef struct {
+	void* data;						// the elements, or 0x0 while they live in <small>.
+	size_t length, capacity;		// number of elements, and how many fit without growing.
+	size_t isize;					// the size of an element.
+	rda_arena_t* arena;				// the arena backing <data>, 0x0 for the heap.
+	union {
+		unsigned char bytes[RDA_VEC_SMALL];
+		max_align_t align;
+	} small;						// the inline buffer.
+} rda_vec_t;
+
+/**
+ * @brief initialize an empty vector.
+ *
+ * @param vec the vector.
+ * @param isize the size of an element.
+ * @param arena the arena to grow in, or 0x0 for the heap.
+ */
+void
+rda_vec_init(rda_vec_t* vec, size_t isize, rda_arena_t* arena);
+
+/**
+ * @brief make room for at least <capacity> elements.
+ *
+ * @param vec the vector.
+ * @param capacity the number of elements.
+ * @return false if the allocation failed or <capacity> elements do not fit in a size_t.
+ */
+bool
+rda_vec_reserve(rda_vec_t* vec, size_t capacity);
+
+/**
+ * @brief append an element, growing the vector if needed; pointers to
+ *  elements are invalidated when it grows.
+ *
+ * @param vec the vector.
+ * @param item the element to be copied in, or 0x0 for a zeroed element.
+ * @return the new element or 0x0 if the allocation failed.
+ */
+void*
+rda_vec_push(rda_vec_t* vec, const void* item);
+
+/**
+ * @brief get the element at an index.
+ *
+ * @param vec the vector.
+ * @param index the index.
+ * @return the element or 0x0 if <index> is out of bounds.
+ */
+void*
+rda_vec_at(const rda_vec_t* vec, size_t index);
+
+/**
+ * @brief remove the element at an index in O(1) by moving the last element
+ *  into its place (the order of elements is not kept).
+ *
+ * @param vec the vector.
+ * @param index the index.
+ */
+void
+rda_vec_swap_remove(rda_vec_t* vec, size_t index);
+
+/**
+ * @brief free the memory of a vector (not arena memory) and empty it.
+ *
+ * @param vec the vector.
+ */
+void
+rda_vec_free(rda_vec_t* vec);
+
+/**
+ * @brief declare a typed view <name> over rda_vec_t for elements of <type>:
+ *  name_init(), name_push(), name_at() and name_data().
+ */
+#define RDA_VEC_TYPED(name, type) \
+	static inline void \
+	name##_init(rda_vec_t* vec, rda_arena_t* arena) { rda_vec_init(vec, sizeof(type), arena); } \
+	static inline type* \
+	name##_push(rda_vec_t* vec, const type* item) { return (type*) rda_vec_push(vec, item); } \
+	static inline type* \
+	name##_at(const rda_vec_t* vec, size_t index) { return (type*) rda_vec_at(vec, index); } \
+	static inline type* \
+	name##_data(const rda_vec_t* vec) { return (type*) (vec->data ? vec->data : (void*) vec->small.bytes); }
+#endif //LRDA_VEC_H
@@ -0,0 +1,225 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file align.c
+ */
+#include "align.h"
+
+/*! @uses calloc, free, qsort */
+#include <stdlib.h>
+
+/*! @uses memcpy, strcspn, strlen, strncmp */
+#include <string.h>
+
+/*! @uses bool, true, false */
+#include <stdbool.h>
+
+/*! @uses rda_internal */
+#include "lib.h"
+
+/*! @uses rda_get_branch_target */
+#include "opnd.h"
+
+/*! @uses rda_vec_t, RDA_VEC_TYPED */
+#include "vec.h"
+
+/// @note a backward branch, from the end of the branch back to <target>.
+typedef struct {
+    size_t target, end;
+} rda_align_edge_t;
+
+/// @note typed access to vectors of branches, loops and backward branches.
+RDA_VEC_TYPED(align_branch_vec, rda_align_branch_t)
+RDA_VEC_TYPED(align_loop_vec, rda_align_loop_t)
+RDA_VEC_TYPED(align_edge_vec, rda_align_edge_t)
+
+/**
+ * @brief check whether an instruction can macro-fuse with a jcc right after
+ *  it: cmp, test, add, sub, and, inc and dec, unless they have both a memory
+ *  operand and an immediate.
+ *
+ * @param inst the decoded instruction.
+ * @return true if <inst> can fuse.
+ */
+rda_internal bool
+is_fusible(const rda_dec_int_t* inst) {
+    static const char* const heads[] = { "cmp", "test", "add", "sub", "and", "inc", "dec" };
+    if (!inst->valid || (inst->id & RDA_ROW_SIMD)) return false;
+    if ((inst->flags & (RDA_INST_FL_READ | RDA_INST_FL_WRITE)) && inst->instruction->instruction_length)
+        return false;
+    const char* mnemonic = inst->instruction->mnemonic;
+    size_t length = strcspn(mnemonic, " ");
+    for (size_t i = 0; i < sizeof heads / sizeof *heads; i++)
+        if (strlen(heads[i]) == length && strncmp(mnemonic, heads[i], length) == 0)
+            return true;
+    return false;
+};
+
+/// @brief qsort comparator, backward branches by target, the farthest reaching first.
+rda_internal int
+compare_edges(const void* a, const void* b) {
+    const rda_align_edge_t* x = a, * y = b;
+    if (x->target != y->target) return x->target < y->target ? -1 : 1;
+    return (x->end < y->end) - (x->end > y->end);
+};
+
+/**
+ * @brief find the instruction of a function starting at an address.
+ *
+ * @param function the function.
+ * @param address the address.
+ * @param index pointer to where the index of the instruction is written.
+ * @return true if an instruction starts at <address>.
+ */
+rda_internal bool
+find_instruction(const rda_dec_fun_t* function, size_t address, size_t* index) {
+    size_t low = 0, high = function->list.length;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        const rda_dec_int_t* inst = rda_inst_vec_at(&function->list, middle);
+        size_t at = function->address + (size_t) (inst->bytes - function->bytes);
+        if (at == address) {
+            *index = middle;
+            return true;
+        }
+        if (at < address) low = middle + 1;
+        else high = middle;
+    }
+    return false;
+};
+
+/**
+ * @brief add the loops of a function whose headers are misaligned, one per
+ *  header, spanning to the end of its farthest backward branch.
+ *
+ * @param loops the loops of the report.
+ * @param edges the backward branches of the function.
+ * @param function the function.
+ * @param index the index of the function.
+ * @return false if the allocation failed.
+ */
+rda_internal bool
+add_loops(rda_vec_t* loops, rda_vec_t* edges, const rda_dec_fun_t* function, size_t index) {
+    rda_align_edge_t* edge = align_edge_vec_data(edges);
+    qsort(edge, edges->length, sizeof *edge, compare_edges);
+    for (size_t i = 0; i < edges->length; i++) {
+        if (i && edge[i].target == edge[i - 1].target) continue;
+        rda_align_loop_t loop = { .function = index, .address = edge[i].target,
+            .offset = edge[i].target - function->address, .size = edge[i].end - edge[i].target };
+        if (!find_instruction(function, loop.address, &loop.index)) continue;
+
+        // the loop can span fewer lines if a smaller padding than the full alignment does.
+        size_t at = loop.address % RDA_ALIGN_FETCH;
+        loop.lines = (unsigned int) ((at + loop.size + RDA_ALIGN_FETCH - 1) / RDA_ALIGN_FETCH);
+        loop.min_lines = (unsigned int) ((loop.size + RDA_ALIGN_FETCH - 1) / RDA_ALIGN_FETCH);
+        if (loop.lines <= loop.min_lines) continue;
+        for (size_t padding = 1; padding < RDA_ALIGN_FETCH; padding++) {
+            size_t shifted = (at + padding) % RDA_ALIGN_FETCH;
+            if ((shifted + loop.size + RDA_ALIGN_FETCH - 1) / RDA_ALIGN_FETCH == loop.min_lines) {
+                loop.padding = (unsigned char) padding;
+                break;
+            }
+        }
+        if (!align_loop_vec_push(loops, &loop)) return false;
+    }
+    edges->length = 0;
+    return true;
+};
+
+/**
+ * @brief find the branches of decoded amd64 functions that cross or end on a
+ *  RDA_ALIGN_BRANCH byte boundary, and the loop headers misaligned for the
+ *  RDA_ALIGN_FETCH byte fetch, by the runtime addresses of the instructions.
+ *
+ * @param functions decoded functions.
+ * @param count the number of <functions>.
+ * @return an allocated report or 0x0 on failure.
+ */
+rda_align_report_t*
+rda_align_create(rda_dec_fun_t** functions, size_t count) {
+    if (!functions) return 0x0;
+    rda_vec_t branches, loops, edges;
+    align_branch_vec_init(&branches, 0x0);
+    align_loop_vec_init(&loops, 0x0);
+    align_edge_vec_init(&edges, 0x0);
+
+    bool complete = true;
+    for (size_t f = 0; f < count && complete; f++) {
+        const rda_dec_fun_t* function = functions[f];
+        if (!function) continue;
+        const rda_dec_int_t* previous = 0x0;
+        size_t previous_address = 0;
+        for (size_t i = 0; i < function->list.length && complete; i++) {
+            const rda_dec_int_t* inst = rda_inst_vec_at(&function->list, i);
+            if (!inst->valid) break;
+            size_t address = function->address + (size_t) (inst->bytes - function->bytes);
+            if (inst->flags & RDA_INST_FL_BRANCH) {
+                // a jcc fused with the instruction before it is handled as one.
+                rda_align_branch_t branch = { .function = f, .index = i, .address = address,
+                    .length = (unsigned char) inst->length };
+                if ((inst->flags & RDA_INST_FL_COND) && previous && is_fusible(previous) && \
+                    previous_address + previous->length == address) {
+                    branch.address = previous_address;
+                    branch.length += (unsigned char) previous->length;
+                    branch.flags |= RDA_ALIGN_FUSED;
+                }
+                size_t end = branch.address + branch.length;
+                if (branch.address / RDA_ALIGN_BRANCH != (end - 1) / RDA_ALIGN_BRANCH)
+                    branch.flags |= RDA_ALIGN_CROSSES;
+                else if (end % RDA_ALIGN_BRANCH == 0)
+                    branch.flags |= RDA_ALIGN_ENDS;
+                if (branch.flags & (RDA_ALIGN_CROSSES | RDA_ALIGN_ENDS)) {
+                    branch.offset = branch.address - function->address;
+                    branch.padding = (unsigned char) (RDA_ALIGN_BRANCH - branch.address % RDA_ALIGN_BRANCH);
+                    complete = align_branch_vec_push(&branches, &branch) != 0x0;
+                }
+
+                // a branch back into the function closes a loop.
+                size_t target;
+                if (rda_get_branch_target(inst, address, &target) && target >= function->address && target <= address) {
+                    rda_align_edge_t edge = { .target = target, .end = address + inst->length };
+                    complete = complete && align_edge_vec_push(&edges, &edge) != 0x0;
+                }
+            }
+            previous = inst;
+            previous_address = address;
+        }
+        complete = complete && add_loops(&loops, &edges, function, f);
+    }
+
+    rda_align_report_t* report = complete ? calloc(1u, sizeof *report) : 0x0;
+    if (report) {
+        report->branch_count = branches.length;
+        report->branches = calloc(branches.length ? branches.length : 1u, sizeof *report->branches);
+        report->loop_count = loops.length;
+        report->loops = calloc(loops.length ? loops.length : 1u, sizeof *report->loops);
+    }
+    if (!report || !report->branches || !report->loops) {
+        rda_align_destroy(report);
+        report = 0x0;
+    }
+    else {
+        if (branches.length)
+            memcpy(report->branches, align_branch_vec_data(&branches), branches.length * sizeof *report->branches);
+        if (loops.length)
+            memcpy(report->loops, align_loop_vec_data(&loops), loops.length * sizeof *report->loops);
+    }
+    rda_vec_free(&branches);
+    rda_vec_free(&loops);
+    rda_vec_free(&edges);
+    return report;
+};
+
+/**
+ * @brief free an alignment report.
+ *
+ * @param report the report to be freed.
+ */
+void
+rda_align_destroy(rda_align_report_t* report) {
+    if (!report) return;
+    free(report->branches);
+    free(report->loops);
+    free(report);
+};
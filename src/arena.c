@@ -0,0 +1,116 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file arena.c
+ */
+#include "arena.h"
+
+/*! @uses calloc, free */
+#include <stdlib.h>
+
+/*! @uses memset */
+#include <string.h>
+
+/*! @uses rda_internal */
+#include "lib.h"
+
+/// @note the alignment of every allocation (and of the block header).
+#define ARENA_ALIGN _Alignof(max_align_t)
+
+/// @note the size of a block header, rounded up to ARENA_ALIGN.
+#define ARENA_HEADER ((sizeof(rda_arena_block_t) + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1))
+
+/**
+ * @brief add a new block of at least <size> bytes to an arena.
+ *
+ * @param arena the arena.
+ * @param size the minimum number of bytes.
+ * @return the new block or 0x0 on failure.
+ */
+rda_internal rda_arena_block_t*
+add_block(rda_arena_t* arena, size_t size) {
+    if (size < arena->block) size = arena->block;
+    rda_arena_block_t* block = calloc(1u, ARENA_HEADER + size);
+    if (!block) return 0x0;
+    block->next = arena->head;
+    block->size = size;
+    arena->head = block;
+    return block;
+};
+
+/**
+ * @brief create an arena.
+ *
+ * @param block the size of every block in bytes (0 for RDA_ARENA_BLOCK).
+ * @return an allocated arena or 0x0 on failure.
+ */
+rda_arena_t*
+rda_arena_create(size_t block) {
+    rda_arena_t* arena = calloc(1u, sizeof *arena);
+    if (!arena) return 0x0;
+    arena->block = block ? block : RDA_ARENA_BLOCK;
+    return arena;
+};
+
+/**
+ * @brief allocate zeroed memory from an arena, aligned to max_align_t.
+ *
+ * @param arena the arena.
+ * @param size the number of bytes.
+ * @return the memory or 0x0 on failure.
+ */
+void*
+rda_arena_alloc(rda_arena_t* arena, size_t size) {
+    if (!arena) return 0x0;
+    size = (size + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+
+    // bump within the current block, or start a new one.
+    rda_arena_block_t* block = arena->head;
+    if (!block || block->size - block->used < size) {
+        block = add_block(arena, size);
+        if (!block) return 0x0;
+    }
+    unsigned char* memory = (unsigned char*) block + ARENA_HEADER + block->used;
+    block->used += size;
+    return memory;
+};
+
+/**
+ * @brief release everything allocated from an arena, keeping a single block
+ *  for reuse.
+ *
+ * @param arena the arena.
+ */
+void
+rda_arena_reset(rda_arena_t* arena) {
+    if (!arena || !arena->head) return;
+
+    // keep the newest block, blocks are zeroed again so allocations stay zeroed.
+    rda_arena_block_t* block = arena->head->next;
+    while (block) {
+        rda_arena_block_t* next = block->next;
+        free(block);
+        block = next;
+    }
+    arena->head->next = 0x0;
+    memset((unsigned char*) arena->head + ARENA_HEADER, 0, arena->head->used);
+    arena->head->used = 0;
+};
+
+/**
+ * @brief free an arena and everything allocated from it.
+ *
+ * @param arena the arena.
+ */
+void
+rda_arena_destroy(rda_arena_t* arena) {
+    if (!arena) return;
+    rda_arena_block_t* block = arena->head;
+    while (block) {
+        rda_arena_block_t* next = block->next;
+        free(block);
+        block = next;
+    }
+    free(arena);
+};
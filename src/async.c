@@ -0,0 +1,426 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file async.c
+ */
+#include "async.h"
+
+/*! @uses calloc, realloc, free */
+#include <stdlib.h>
+
+/*! @uses thrd_t, mtx_t, cnd_t */
+#include <threads.h>
+
+/*! @uses atomic_size_t, atomic_fetch_add, atomic_fetch_sub */
+#include <stdatomic.h>
+
+/*! @uses rda_internal, rda_get_context */
+#include "lib.h"
+
+/*! @uses rda_vec_t */
+#include "vec.h"
+
+/// @note a callback registered by a submission.
+typedef struct {
+    rda_async_callback_t callback;
+    void* data;
+} rda_async_waiter_t;
+
+/// @note typed access to a vector of rda_async_waiter_t.
+RDA_VEC_TYPED(waiter_vec, rda_async_waiter_t)
+
+/// @note a decode request, which is also its future.
+struct rda_future {
+    void* address;                  // the address to be decoded.
+    int priority;                   // the (highest) priority it was submitted with.
+    size_t sequence;                // submission order, for equal priorities.
+    size_t heap_at;                 // position in the queue while pending.
+    bool running, done;             // if a worker has taken it, and if it has completed.
+    rda_dec_fun_t* function;        // the result.
+    rda_vec_t waiters;              // callbacks to be called on completion.
+    atomic_size_t references;       // one per submission, plus one while queued.
+    mtx_t lock;                     // guards <done> and <function> for waiting.
+    cnd_t finished;                 // signalled on completion.
+};
+
+/// @note a pool of workers, a priority queue and a map of requests in flight.
+struct rda_async {
+    mtx_t lock;                     // guards everything below.
+    cnd_t work;                     // signalled when a request is queued or the pool stops.
+    bool stop;                      // if the pool is being destroyed.
+    rda_future_t** heap;            // pending requests, a max-heap by (priority, -sequence).
+    size_t heap_length, heap_capacity;
+    rda_future_t** map;             // requests in flight by address (open addressing).
+    size_t map_length, map_capacity;
+    size_t sequence;                // next submission number.
+    mtx_t decode;                   // serializes decodes into a context arena (arenas are not thread-safe).
+    thrd_t workers[RDA_ASYNC_WORKERS_MAX];
+    size_t worker_count;
+};
+
+/// @brief check whether a should be decoded before b.
+rda_internal bool
+runs_before(const rda_future_t* a, const rda_future_t* b) {
+    if (a->priority != b->priority) return a->priority > b->priority;
+    return a->sequence < b->sequence;
+};
+
+/// @brief place a request at a heap position.
+rda_internal void
+heap_set(rda_async_t* pool, size_t at, rda_future_t* future) {
+    pool->heap[at] = future;
+    future->heap_at = at;
+};
+
+/// @brief move the request at <at> up the heap.
+rda_internal void
+heap_up(rda_async_t* pool, size_t at) {
+    rda_future_t* future = pool->heap[at];
+    while (at && runs_before(future, pool->heap[(at - 1) / 2])) {
+        heap_set(pool, at, pool->heap[(at - 1) / 2]);
+        at = (at - 1) / 2;
+    }
+    heap_set(pool, at, future);
+};
+
+/// @brief move the request at <at> down the heap.
+rda_internal void
+heap_down(rda_async_t* pool, size_t at) {
+    rda_future_t* future = pool->heap[at];
+    while (1) {
+        size_t child = at * 2 + 1;
+        if (child >= pool->heap_length) break;
+        if (child + 1 < pool->heap_length && runs_before(pool->heap[child + 1], pool->heap[child]))
+            child++;
+        if (!runs_before(pool->heap[child], future)) break;
+        heap_set(pool, at, pool->heap[child]);
+        at = child;
+    }
+    heap_set(pool, at, future);
+};
+
+/// @brief take the first request off the heap.
+rda_internal rda_future_t*
+heap_pop(rda_async_t* pool) {
+    rda_future_t* first = pool->heap[0];
+    if (--pool->heap_length) {
+        heap_set(pool, 0, pool->heap[pool->heap_length]);
+        heap_down(pool, 0);
+    }
+    return first;
+};
+
+/// @brief hash an address into the request map.
+rda_internal size_t
+map_slot(const rda_async_t* pool, const void* address) {
+    size_t key = (size_t) address;
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdull;
+    key ^= key >> 33;
+    return key & (pool->map_capacity - 1);
+};
+
+/// @brief find the request in flight for an address.
+rda_internal rda_future_t*
+map_find(const rda_async_t* pool, const void* address) {
+    for (size_t i = map_slot(pool, address); pool->map[i]; i = (i + 1) & (pool->map_capacity - 1))
+        if (pool->map[i]->address == address)
+            return pool->map[i];
+    return 0x0;
+};
+
+/// @brief add a request to the map, growing it past half full.
+rda_internal bool
+map_insert(rda_async_t* pool, rda_future_t* future) {
+    if ((pool->map_length + 1) * 2 > pool->map_capacity) {
+        rda_future_t** old = pool->map;
+        size_t old_capacity = pool->map_capacity;
+        rda_future_t** map = calloc(old_capacity * 2, sizeof *map);
+        if (!map) return false;
+        pool->map = map;
+        pool->map_capacity = old_capacity * 2;
+        pool->map_length = 0;
+        for (size_t i = 0; i < old_capacity; i++)
+            if (old[i]) map_insert(pool, old[i]);
+        free(old);
+    }
+    size_t i = map_slot(pool, future->address);
+    while (pool->map[i])
+        i = (i + 1) & (pool->map_capacity - 1);
+    pool->map[i] = future;
+    pool->map_length++;
+    return true;
+};
+
+/// @brief remove a request from the map, shifting back the entries after it.
+rda_internal void
+map_remove(rda_async_t* pool, const rda_future_t* future) {
+    size_t mask = pool->map_capacity - 1, i = map_slot(pool, future->address);
+    while (pool->map[i] && pool->map[i] != future)
+        i = (i + 1) & mask;
+    if (!pool->map[i]) return;
+    pool->map[i] = 0x0;
+    pool->map_length--;
+
+    // re-place every entry of the cluster after the hole.
+    for (size_t j = (i + 1) & mask; pool->map[j]; j = (j + 1) & mask) {
+        rda_future_t* moved = pool->map[j];
+        size_t home = map_slot(pool, moved->address);
+        if (((j - home) & mask) >= ((j - i) & mask)) {
+            pool->map[i] = moved;
+            pool->map[j] = 0x0;
+            i = j;
+        }
+    }
+};
+
+/**
+ * @brief complete a request and call its callbacks; the pool lock must not be held.
+ *
+ * @param future the request, already removed from the queue and map.
+ * @param function the result.
+ */
+rda_internal void
+complete(rda_future_t* future, rda_dec_fun_t* function) {
+    mtx_lock(&future->lock);
+    future->function = function;
+    future->done = true;
+    cnd_broadcast(&future->finished);
+    mtx_unlock(&future->lock);
+
+    // no submission can join a completed request, so the callbacks are final.
+    for (size_t i = 0; i < future->waiters.length; i++) {
+        rda_async_waiter_t* waiter = waiter_vec_at(&future->waiters, i);
+        waiter->callback(future->address, function, waiter->data);
+    }
+
+    // drop the reference held by the queue.
+    rda_future_release(future);
+};
+
+/**
+ * @brief the loop of a worker thread.
+ *
+ * @param argument the pool.
+ * @return 0.
+ */
+rda_internal int
+work(void* argument) {
+    rda_async_t* pool = argument;
+    while (1) {
+        mtx_lock(&pool->lock);
+        while (!pool->stop && !pool->heap_length)
+            cnd_wait(&pool->work, &pool->lock);
+        if (pool->stop) {
+            mtx_unlock(&pool->lock);
+            return 0;
+        }
+        rda_future_t* future = heap_pop(pool);
+        future->running = true;
+        mtx_unlock(&pool->lock);
+
+        // decode outside of the lock, serialized only when decoding into an arena.
+        bool arena = rda_get_context().arena != 0x0;
+        if (arena) mtx_lock(&pool->decode);
+        rda_dec_fun_t* function = rda_disassemble64(future->address);
+        if (arena) mtx_unlock(&pool->decode);
+
+        mtx_lock(&pool->lock);
+        map_remove(pool, future);
+        mtx_unlock(&pool->lock);
+        complete(future, function);
+    }
+};
+
+/**
+ * @brief create a pool of background workers; workers decode with the
+ *  context (rda_get_context()) current at the time of every decode.
+ *
+ * @param workers the number of worker threads (0 for RDA_ASYNC_WORKERS).
+ * @return an allocated pool or 0x0 on failure.
+ */
+rda_async_t*
+rda_async_create(size_t workers) {
+    if (!workers) workers = RDA_ASYNC_WORKERS;
+    if (workers > RDA_ASYNC_WORKERS_MAX) workers = RDA_ASYNC_WORKERS_MAX;
+
+    rda_async_t* pool = calloc(1u, sizeof *pool);
+    if (!pool) return 0x0;
+    pool->heap_capacity = 64;
+    pool->heap = calloc(pool->heap_capacity, sizeof *pool->heap);
+    pool->map_capacity = 128;
+    pool->map = calloc(pool->map_capacity, sizeof *pool->map);
+    if (!pool->heap || !pool->map || mtx_init(&pool->lock, mtx_plain) != thrd_success) {
+        free(pool->heap);
+        free(pool->map);
+        free(pool);
+        return 0x0;
+    }
+    cnd_init(&pool->work);
+    mtx_init(&pool->decode, mtx_plain);
+
+    // start the workers, a pool with fewer than asked for still works.
+    for (size_t i = 0; i < workers; i++) {
+        if (thrd_create(&pool->workers[pool->worker_count], work, pool) != thrd_success)
+            break;
+        pool->worker_count++;
+    }
+    if (!pool->worker_count) {
+        rda_async_destroy(pool);
+        return 0x0;
+    }
+    return pool;
+};
+
+/**
+ * @brief stop and free a pool; decodes in progress finish, pending ones
+ *  complete with a 0x0 function. futures stay valid until released.
+ *
+ * @param pool the pool.
+ */
+void
+rda_async_destroy(rda_async_t* pool) {
+    if (!pool) return;
+    mtx_lock(&pool->lock);
+    pool->stop = true;
+    cnd_broadcast(&pool->work);
+    mtx_unlock(&pool->lock);
+    for (size_t i = 0; i < pool->worker_count; i++)
+        thrd_join(pool->workers[i], 0x0);
+
+    // cancel what is still queued.
+    for (size_t i = 0; i < pool->heap_length; i++)
+        complete(pool->heap[i], 0x0);
+    free(pool->heap);
+    free(pool->map);
+    cnd_destroy(&pool->work);
+    mtx_destroy(&pool->lock);
+    mtx_destroy(&pool->decode);
+    free(pool);
+};
+
+/**
+ * @brief queue a function for disassembly; higher priorities are decoded
+ *  first, equal priorities in submission order. a pending submission of the
+ *  same address is joined instead (and raised to <priority> if higher).
+ *
+ * @param pool the pool.
+ * @param address the address of the function.
+ * @param priority the priority of the request.
+ * @param callback an optional callback for when it has been decoded.
+ * @param data user data passed to <callback>.
+ * @return a future to be released with rda_future_release(), or 0x0 on failure.
+ */
+rda_future_t*
+rda_async_submit(rda_async_t* pool, void* address, int priority, rda_async_callback_t callback, void* data) {
+    if (!pool || !address) return 0x0;
+    rda_async_waiter_t waiter = { callback, data };
+
+    mtx_lock(&pool->lock);
+    if (pool->stop) {
+        mtx_unlock(&pool->lock);
+        return 0x0;
+    }
+
+    // join a request in flight for the same address.
+    rda_future_t* future = map_find(pool, address);
+    if (future) {
+        if (callback && !waiter_vec_push(&future->waiters, &waiter)) {
+            mtx_unlock(&pool->lock);
+            return 0x0;
+        }
+        if (!future->running && priority > future->priority) {
+            future->priority = priority;
+            heap_up(pool, future->heap_at);
+        }
+        atomic_fetch_add(&future->references, 1u);
+        mtx_unlock(&pool->lock);
+        return future;
+    }
+
+    // otherwise queue a new one, growing the queue if needed.
+    if (pool->heap_length == pool->heap_capacity) {
+        rda_future_t** heap = realloc(pool->heap, pool->heap_capacity * 2 * sizeof *heap);
+        if (!heap) {
+            mtx_unlock(&pool->lock);
+            return 0x0;
+        }
+        pool->heap = heap;
+        pool->heap_capacity *= 2;
+    }
+    future = calloc(1u, sizeof *future);
+    if (!future || mtx_init(&future->lock, mtx_plain) != thrd_success) {
+        free(future);
+        mtx_unlock(&pool->lock);
+        return 0x0;
+    }
+    cnd_init(&future->finished);
+    future->address = address;
+    future->priority = priority;
+    future->sequence = pool->sequence++;
+    waiter_vec_init(&future->waiters, 0x0);
+    if (callback) waiter_vec_push(&future->waiters, &waiter);
+    atomic_init(&future->references, 2u);
+    if (!map_insert(pool, future)) {
+        mtx_unlock(&pool->lock);
+        atomic_store(&future->references, 1u);
+        rda_future_release(future);
+        return 0x0;
+    }
+    pool->heap[pool->heap_length++] = future;
+    heap_up(pool, pool->heap_length - 1);
+    cnd_signal(&pool->work);
+    mtx_unlock(&pool->lock);
+    return future;
+};
+
+/**
+ * @brief check whether a future has completed, without blocking.
+ *
+ * @param future the future.
+ * @return true if rda_future_wait() would not block.
+ */
+bool
+rda_future_ready(rda_future_t* future) {
+    if (!future) return false;
+    mtx_lock(&future->lock);
+    bool done = future->done;
+    mtx_unlock(&future->lock);
+    return done;
+};
+
+/**
+ * @brief block until a future has completed.
+ *
+ * @param future the future.
+ * @return the disassembled function (owned by the future), or 0x0 if the
+ *  pool was destroyed before it was decoded.
+ */
+rda_dec_fun_t*
+rda_future_wait(rda_future_t* future) {
+    if (!future) return 0x0;
+    mtx_lock(&future->lock);
+    while (!future->done)
+        cnd_wait(&future->finished, &future->lock);
+    rda_dec_fun_t* function = future->function;
+    mtx_unlock(&future->lock);
+    return function;
+};
+
+/**
+ * @brief release a reference to a future; the last one frees the future and
+ *  its function.
+ *
+ * @param future the future.
+ */
+void
+rda_future_release(rda_future_t* future) {
+    if (!future || atomic_fetch_sub(&future->references, 1u) != 1u)
+        return;
+    rda_free_function(future->function);
+    rda_vec_free(&future->waiters);
+    cnd_destroy(&future->finished);
+    mtx_destroy(&future->lock);
+    free(future);
+};
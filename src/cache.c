@@ -0,0 +1,501 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file cache.c
+ */
+#define _GNU_SOURCE
+#include "cache.h"
+
+/*! @uses calloc, free, qsort */
+#include <stdlib.h>
+
+/*! @uses memcpy, memcmp, strlen */
+#include <string.h>
+
+/*! @uses FILE, fopen, fwrite, fclose */
+#include <stdio.h>
+
+/*! @uses open, O_RDONLY */
+#include <fcntl.h>
+
+/*! @uses mmap, munmap */
+#include <sys/mman.h>
+
+/*! @uses fstat */
+#include <sys/stat.h>
+
+/*! @uses close */
+#include <unistd.h>
+
+/*! @uses dl_iterate_phdr, ElfW */
+#include <link.h>
+
+/*! @uses rda_internal */
+#include "lib.h"
+
+/*! @uses rda_get_branch_target, rda_get_rip_target */
+#include "opnd.h"
+
+/*! @uses internal_table, internal_simd_table */
+#include "tables.h"
+
+/*! @uses rda_memmap_readable */
+#include "memmap.h"
+
+/**
+ * @brief hash <length> bytes 8 at a time (a multiply/rotate mix, not cryptographic).
+ *
+ * @param bytes the bytes to be hashed.
+ * @param length the number of bytes.
+ * @param seed the initial hash value.
+ * @return the 64-bit hash.
+ */
+rda_internal uint64_t
+hash_bytes(const void* bytes, size_t length, uint64_t seed) {
+    const unsigned char* ptr = bytes;
+    uint64_t hash = seed ^ (length * 0x9e3779b97f4a7c15ull);
+    while (length >= 8) {
+        uint64_t word;
+        memcpy(&word, ptr, 8);
+        hash = (hash ^ word) * 0xff51afd7ed558ccdull;
+        hash = (hash << 31) | (hash >> 33);
+        ptr += 8;
+        length -= 8;
+    }
+    uint64_t tail = 0;
+    memcpy(&tail, ptr, length);
+    hash = (hash ^ tail) * 0xc4ceb9fe1a85ec53ull;
+    return hash ^ (hash >> 29);
+};
+
+/**
+ * @brief hash a decode table, so that cached row ids are rejected if the table changes.
+ */
+rda_internal uint64_t
+hash_table(const rda_int_t* table, size_t count, uint64_t seed) {
+    uint64_t hash = seed;
+    for (size_t i = 0; i < count; i++) {
+        const rda_int_t* row = &table[i];
+        hash = hash_bytes(row->mnemonic, strlen(row->mnemonic), hash);
+        int fields[] = { row->opcode_length, row->instruction_length, row->opcode_size, row->modrm,
+            row->plus_reg, row->modrm_reg, (int) row->type, row->flags, row->vex_encoding, row->simd_size };
+        hash = hash_bytes(row->bytes, sizeof row->bytes, hash);
+        hash = hash_bytes(fields, sizeof fields, hash);
+    }
+    return hash;
+};
+
+/**
+ * @brief get the hash of both decode tables (computed once).
+ */
+rda_internal uint64_t
+get_table_hash() {
+    static uint64_t hash = 0;
+    if (!hash) {
+        uint64_t value = hash_table(internal_table, RDA_INT_TABLE_SIZE, RDA_CACHE_VERSION);
+        value = hash_table(internal_simd_table, RDA_INT_SIMD_TABLE_SIZE, value);
+        hash = value ? value : 1;
+    }
+    return hash;
+};
+
+/// @note state passed through dl_iterate_phdr to find a module.
+typedef struct {
+    size_t address;                 // the address to look for.
+    unsigned char* build_id;        // output build-id buffer.
+    size_t length, base;            // output build-id length and module base.
+    bool found;                     // if the module was found.
+} rda_module_query_t;
+
+/**
+ * @brief dl_iterate_phdr callback, match the module containing the address
+ *  and read its NT_GNU_BUILD_ID note.
+ */
+rda_internal int
+find_module(struct dl_phdr_info* info, size_t size, void* data) {
+    (void) size;
+    rda_module_query_t* query = data;
+
+    // is the address within one of the loaded segments?
+    bool within = false;
+    for (size_t i = 0; i < info->dlpi_phnum && !within; i++) {
+        const ElfW(Phdr)* phdr = &info->dlpi_phdr[i];
+        size_t start = info->dlpi_addr + phdr->p_vaddr;
+        if (phdr->p_type == PT_LOAD && query->address >= start && query->address < start + phdr->p_memsz)
+            within = true;
+    }
+    if (!within) return 0;
+    query->found = true;
+    query->base = info->dlpi_addr;
+
+    // walk the notes for the gnu build-id.
+    for (size_t i = 0; i < info->dlpi_phnum; i++) {
+        const ElfW(Phdr)* phdr = &info->dlpi_phdr[i];
+        if (phdr->p_type != PT_NOTE) continue;
+        const unsigned char* note = (const unsigned char*) (info->dlpi_addr + phdr->p_vaddr);
+        const unsigned char* end = note + phdr->p_memsz;
+        while (note + sizeof(ElfW(Nhdr)) <= end) {
+            const ElfW(Nhdr)* nhdr = (const ElfW(Nhdr)*) note;
+            const unsigned char* name = note + sizeof *nhdr;
+            const unsigned char* desc = name + ((nhdr->n_namesz + 3) & ~3u);
+            if (nhdr->n_type == NT_GNU_BUILD_ID && nhdr->n_namesz == 4 && memcmp(name, "GNU", 4) == 0) {
+                query->length = nhdr->n_descsz > RDA_BUILD_ID_MAX ? RDA_BUILD_ID_MAX : nhdr->n_descsz;
+                memcpy(query->build_id, desc, query->length);
+                return 1;
+            }
+            note = desc + ((nhdr->n_descsz + 3) & ~3u);
+        }
+    }
+    return 1;
+};
+
+/**
+ * @brief get the build-id and base address of the loaded module containing <address>.
+ *
+ * @param address any address within the module.
+ * @param build_id buffer of RDA_BUILD_ID_MAX bytes for the build-id.
+ * @param length pointer to where the build-id length is written (0 if none).
+ * @param base pointer to where the module base is written.
+ * @return true if a module containing <address> was found.
+ */
+bool
+rda_get_build_id(const void* address, unsigned char* build_id, size_t* length, size_t* base) {
+    rda_module_query_t query = { (size_t) address, build_id, 0, 0, false };
+    dl_iterate_phdr(find_module, &query);
+    *length = query.length;
+    *base = query.base;
+    return query.found;
+};
+
+/**
+ * @brief qsort comparator, order functions by address.
+ */
+rda_internal int
+compare_functions(const void* a, const void* b) {
+    const rda_dec_fun_t* fa = *(rda_dec_fun_t* const*) a;
+    const rda_dec_fun_t* fb = *(rda_dec_fun_t* const*) b;
+    return (fa->address > fb->address) - (fa->address < fb->address);
+};
+
+/**
+ * @brief round <value> up to a multiple of 8.
+ */
+rda_internal uint64_t
+align8(uint64_t value) {
+    return (value + 7) & ~7ull;
+};
+
+/**
+ * @brief write decoded functions of a single module to a cache file.
+ *
+ * @param path the path of the cache file.
+ * @param functions decoded functions, all within the same module.
+ * @param count the number of <functions>.
+ * @return true on success, false otherwise.
+ */
+bool
+rda_cache_write(const char* path, rda_dec_fun_t** functions, size_t count) {
+    if (!path || !functions || count == 0)
+        return false;
+
+    // identify the module.
+    rda_cache_header_t header = { 0 };
+    size_t build_id_length = 0, base = 0;
+    if (!rda_get_build_id((void*) functions[0]->address, header.build_id, &build_id_length, &base))
+        return false;
+    header.magic = RDA_CACHE_MAGIC;
+    header.version = RDA_CACHE_VERSION;
+    header.table_hash = get_table_hash();
+    header.build_id_length = (uint32_t) build_id_length;
+
+    // sort a copy of the function list and count the records.
+    rda_dec_fun_t** sorted = calloc(count, sizeof *sorted);
+    if (!sorted) return false;
+    memcpy(sorted, functions, count * sizeof *sorted);
+    qsort(sorted, count, sizeof *sorted, compare_functions);
+    size_t instruction_count = 0, xref_count = 0;
+    for (size_t i = 0; i < count; i++) {
+        size_t address = sorted[i]->address;
+        for (size_t j = 0; j < sorted[i]->list.length; j++) {
+            const rda_dec_int_t* inst = rda_get_instruction_at(sorted[i], j);
+            size_t target;
+            xref_count += rda_get_branch_target(inst, address, &target);
+            xref_count += rda_get_rip_target(inst, address, &target);
+            address += inst->length;
+        }
+        instruction_count += sorted[i]->list.length;
+    }
+
+    // lay out the sections.
+    header.function_count = (uint32_t) count;
+    header.instruction_count = (uint32_t) instruction_count;
+    header.xref_count = (uint32_t) xref_count;
+    header.functions = align8(sizeof header);
+    header.instructions = align8(header.functions + count * sizeof(rda_cache_fun_t));
+    header.xrefs = align8(header.instructions + instruction_count * sizeof(rda_cache_int_t));
+    header.file_size = align8(header.xrefs + xref_count * sizeof(rda_cache_xref_t));
+
+    // build the file image in memory, then write it in one go.
+    unsigned char* image = calloc(1u, header.file_size);
+    if (!image) {
+        free(sorted);
+        return false;
+    }
+    memcpy(image, &header, sizeof header);
+    rda_cache_fun_t* out_functions = (rda_cache_fun_t*) (image + header.functions);
+    rda_cache_int_t* out_instructions = (rda_cache_int_t*) (image + header.instructions);
+    rda_cache_xref_t* out_xrefs = (rda_cache_xref_t*) (image + header.xrefs);
+    size_t inst_at = 0, xref_at = 0;
+    for (size_t i = 0; i < count; i++) {
+        const rda_dec_fun_t* function = sorted[i];
+        rda_cache_fun_t* record = &out_functions[i];
+        record->offset = function->address - base;
+        record->length = (uint32_t) function->length;
+        record->hash = hash_bytes((const void*) function->address, function->length, 0);
+        record->first = (uint32_t) inst_at;
+        record->count = (uint32_t) function->list.length;
+        record->first_xref = (uint32_t) xref_at;
+
+        size_t offset = 0;
+        for (size_t j = 0; j < function->list.length; j++) {
+            const rda_dec_int_t* inst = rda_get_instruction_at((rda_dec_fun_t*) function, j);
+            rda_cache_int_t* out = &out_instructions[inst_at++];
+            out->offset = (uint32_t) offset;
+            out->id = inst->id;
+            out->length = (uint8_t) inst->length;
+            out->prefix_count = (uint8_t) inst->prefix_count;
+            out->rex_byte = (uint8_t) inst->rex_byte;
+            out->vex_encoding = (uint8_t) inst->vex_encoding;
+            out->valid = inst->valid;
+            out->flags = inst->flags;
+
+            // cross references.
+            size_t address = function->address + offset, target;
+            if (rda_get_branch_target(inst, address, &target)) {
+                bool call = inst->flags & RDA_INST_FL_CALL;
+                out_xrefs[xref_at++] = (rda_cache_xref_t) { address - base, target - base,
+                    call ? RDA_XREF_TY_CALL : RDA_XREF_TY_BRANCH, (uint32_t) i };
+            }
+            if (rda_get_rip_target(inst, address, &target))
+                out_xrefs[xref_at++] = (rda_cache_xref_t) { address - base, target - base,
+                    RDA_XREF_TY_DATA, (uint32_t) i };
+            offset += inst->length;
+        }
+        record->xref_count = (uint32_t) (xref_at - record->first_xref);
+    }
+    free(sorted);
+
+    // write the image.
+    FILE* file = fopen(path, "wb");
+    bool ok = file && fwrite(image, 1u, header.file_size, file) == header.file_size;
+    if (file && fclose(file) != 0)
+        ok = false;
+    free(image);
+    return ok;
+};
+
+/**
+ * @brief check that a section of a cache file lies within the file and is aligned.
+ *
+ * @param offset the offset of the section.
+ * @param count the number of records.
+ * @param record the size of a record.
+ * @param size the size of the file.
+ * @return true if the section is valid.
+ */
+rda_internal bool
+is_section(uint64_t offset, uint64_t count, size_t record, size_t size) {
+    return offset % 8u == 0 && offset <= size && count <= (size - offset) / record;
+};
+
+/**
+ * @brief check that a cached function refers to records of the file, and
+ *  to bytes of the module that are readable.
+ *
+ * @param header the header of the cache file (with valid sections).
+ * @param function the cached function.
+ * @param base the runtime base address of the module.
+ * @return true if the function is valid.
+ */
+rda_internal bool
+is_function(const rda_cache_header_t* header, const rda_cache_fun_t* function, size_t base) {
+    return (uint64_t) function->first + function->count <= header->instruction_count && \
+        (uint64_t) function->first_xref + function->xref_count <= header->xref_count && \
+        function->offset <= SIZE_MAX - base - function->length && \
+        rda_memmap_readable((const void*) (base + function->offset), function->length) == function->length;
+};
+
+/**
+ * @brief map a cache file and bind it to the loaded module containing <module>;
+ *  the file is rejected if the format, the decode tables or the build-id do not
+ *  match (modules without a build-id are checked via function hashes instead).
+ *
+ * @param path the path of the cache file.
+ * @param module any address within the module the cache was written for.
+ * @return an allocated cache or 0x0 if the file is missing or stale.
+ */
+rda_cache_t*
+rda_cache_open(const char* path, const void* module) {
+    // map the file read-only.
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return 0x0;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(rda_cache_header_t)) {
+        close(fd);
+        return 0x0;
+    }
+    void* map = mmap(0x0, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return 0x0;
+
+    // validate the header and the section bounds.
+    const rda_cache_header_t* header = map;
+    size_t size = (size_t) st.st_size;
+    bool ok = header->magic == RDA_CACHE_MAGIC && header->version == RDA_CACHE_VERSION && \
+        header->table_hash == get_table_hash() && header->file_size == size && \
+        is_section(header->functions, header->function_count, sizeof(rda_cache_fun_t), size) && \
+        is_section(header->instructions, header->instruction_count, sizeof(rda_cache_int_t), size) && \
+        is_section(header->xrefs, header->xref_count, sizeof(rda_cache_xref_t), size) && \
+        header->build_id_length <= RDA_BUILD_ID_MAX;
+
+    // compare the build-id of the live module.
+    unsigned char build_id[RDA_BUILD_ID_MAX];
+    size_t build_id_length = 0, base = 0;
+    ok = ok && rda_get_build_id(module, build_id, &build_id_length, &base);
+    ok = ok && build_id_length == header->build_id_length && \
+        memcmp(build_id, header->build_id, build_id_length) == 0;
+    // every function must refer to records of the file and to readable bytes of the module.
+    const rda_cache_fun_t* functions = (const rda_cache_fun_t*) ((const unsigned char*) map + header->functions);
+    for (size_t i = 0; ok && i < header->function_count; i++)
+        ok = is_function(header, &functions[i], base);
+    rda_cache_t* cache = ok ? calloc(1u, sizeof *cache) : 0x0;
+    if (!cache) {
+        munmap(map, size);
+        return 0x0;
+    }
+
+    // bind the sections in place.
+    cache->header = header;
+    cache->functions = functions;
+    cache->instructions = (const rda_cache_int_t*) ((const unsigned char*) map + header->instructions);
+    cache->xrefs = (const rda_cache_xref_t*) ((const unsigned char*) map + header->xrefs);
+    cache->base = base;
+    cache->map = map;
+    cache->size = size;
+
+    // without a build-id, the function hashes are all we have.
+    if (build_id_length == 0 && !rda_cache_verify(cache)) {
+        rda_cache_close(cache);
+        return 0x0;
+    }
+    return cache;
+};
+
+/**
+ * @brief check every cached function hash against the live bytes.
+ *
+ * @param cache an open cache.
+ * @return true if all functions are unchanged.
+ */
+bool
+rda_cache_verify(const rda_cache_t* cache) {
+    for (size_t i = 0; i < cache->header->function_count; i++) {
+        const rda_cache_fun_t* function = &cache->functions[i];
+        const void* live = (const void*) (cache->base + function->offset);
+        if (rda_memmap_readable(live, function->length) < function->length || \
+            hash_bytes(live, function->length, 0) != function->hash)
+            return false;
+    }
+    return true;
+};
+
+/**
+ * @brief find the cached function starting at <address>.
+ *
+ * @param cache an open cache.
+ * @param address the runtime address of the function.
+ * @return the cached function or 0x0 if it is not in the cache.
+ */
+const rda_cache_fun_t*
+rda_cache_find(const rda_cache_t* cache, const void* address) {
+    uint64_t offset = (size_t) address - cache->base;
+    size_t low = 0, high = cache->header->function_count;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (cache->functions[mid].offset < offset) low = mid + 1;
+        else high = mid;
+    }
+    if (low < cache->header->function_count && cache->functions[low].offset == offset)
+        return &cache->functions[low];
+    return 0x0;
+};
+
+/**
+ * @brief build a rda_dec_fun_t from a cached function without decoding.
+ *
+ * @param cache an open cache.
+ * @param function a cached function from <cache>.
+ * @return an allocated function, same as rda_disassemble64().
+ */
+rda_dec_fun_t*
+rda_cache_load(const rda_cache_t* cache, const rda_cache_fun_t* function) {
+    if (!cache || !function)
+        return 0x0;
+    const void* live = (const void*) (cache->base + function->offset);
+    if (rda_memmap_readable(live, function->length) < function->length)
+        return 0x0;
+
+    // allocate the structure.
+    rda_dec_fun_t* result = calloc(1u, sizeof *result);
+    if (!result) return 0x0;
+    result->address = (size_t) live;
+    result->length = function->length;
+    rda_context_t ctx = rda_get_context();
+    rda_inst_vec_init(&result->list, ctx.arena);
+    result->snapshot = ctx.snapshot;
+
+    // view live memory, or snapshot the bytes processed, same as the decoder.
+    if (result->snapshot) {
+        result->bytes = calloc(1u, function->length ? function->length : 1u);
+        if (result->bytes)
+            memcpy(result->bytes, live, function->length);
+    }
+    else result->bytes = (unsigned char*) live;
+    if (!result->bytes || !rda_vec_reserve(&result->list, function->count)) {
+        rda_free_function(result);
+        return 0x0;
+    }
+
+    // rebuild every instruction from its table row.
+    const unsigned char* bytes = result->bytes;
+    for (size_t i = 0; i < function->count; i++) {
+        const rda_cache_int_t* cached = &cache->instructions[function->first + i];
+        if ((uint64_t) cached->offset + cached->length > function->length) break;
+        rda_dec_int_t* inst = rda_inst_vec_push(&result->list, 0x0);
+        if (!inst) break;
+        const rda_int_t* row = rda_get_row(cached->id);
+        inst->instruction = cached->valid && row ? row : &internal_invalid_row;
+        inst->id = cached->id;
+        inst->bytes = bytes + cached->offset;
+        inst->length = cached->length;
+        inst->prefix_count = cached->prefix_count;
+        inst->rex_byte = cached->rex_byte;
+        inst->vex_encoding = cached->vex_encoding;
+        inst->valid = cached->valid && row;
+        inst->flags = inst->valid ? cached->flags : 0;
+    }
+    return result;
+};
+
+/**
+ * @brief unmap and free a cache.
+ *
+ * @param cache an open cache.
+ */
+void
+rda_cache_close(rda_cache_t* cache) {
+    if (!cache) return;
+    munmap(cache->map, cache->size);
+    free(cache);
+};
@@ -0,0 +1,461 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file callgraph.c
+ */
+#define _GNU_SOURCE
+#include "callgraph.h"
+
+/*! @uses calloc, malloc, free, qsort */
+#include <stdlib.h>
+
+/*! @uses memset */
+#include <string.h>
+
+/*! @uses dl_iterate_phdr, ElfW */
+#include <link.h>
+
+/*! @uses sysconf, _SC_NPROCESSORS_ONLN */
+#include <unistd.h>
+
+/*! @uses thrd_t, mtx_t, cnd_t */
+#include <threads.h>
+
+/*! @uses atomic_size_t, atomic_compare_exchange_strong */
+#include <stdatomic.h>
+
+/*! @uses rda_internal, rda_get_context */
+#include "lib.h"
+
+/*! @uses rda_disassemble64, rda_disassemble_range64 */
+#include "disas.h"
+
+/*! @uses rda_get_branch_target */
+#include "opnd.h"
+
+/*! @uses rda_get_symtab, rda_symtab_lookup, rda_symtab_target */
+#include "symtab.h"
+
+/*! @uses rda_vec_t, RDA_VEC_TYPED */
+#include "vec.h"
+
+/// @note a call site, the function containing it and the function it calls.
+typedef struct {
+    size_t caller, callee, site;    // addresses.
+} rda_call_t;
+
+/// @note an executable segment, [start, end).
+typedef struct {
+    size_t start, end;
+} rda_callgraph_segment_t;
+
+/// @note typed access to vectors of rda_call_t and rda_callgraph_segment_t.
+RDA_VEC_TYPED(call_vec, rda_call_t)
+RDA_VEC_TYPED(callgraph_segment_vec, rda_callgraph_segment_t)
+
+/// @note the state of a build, shared by its workers.
+typedef struct {
+    atomic_size_t* visited;         // open addressing set of every function address seen (0 is empty).
+    size_t visited_mask;            // number of <visited> slots - 1.
+    size_t* functions;              // the functions in discovery order, the frontier is [taken, published).
+    size_t max_functions;           // capacity of <functions>.
+    size_t taken, published;        // functions taken by a worker, and functions discovered.
+    size_t active;                  // workers decoding a function.
+    bool truncated;                 // if a function did not fit.
+    mtx_t lock;                     // guards <functions> and the counters.
+    cnd_t frontier;                 // signalled when a function is published or the build ends.
+    mtx_t decode;                   // serializes decodes into a context arena (arenas are not thread-safe).
+    const rda_symtab_t* symtab;     // for sized functions and plt stubs, may be 0x0.
+    const rda_callgraph_segment_t* segments; // the executable segments, ordered.
+    size_t segment_count;           // number of <segments>.
+    bool plt;                       // if calls are followed through plt stubs and got slots.
+} rda_callgraph_build_t;
+
+/// @note a worker of a build and the call sites it found.
+typedef struct {
+    rda_callgraph_build_t* build;   // the shared state.
+    rda_vec_t calls;                // rda_call_t.
+    bool failed;                    // if an allocation failed.
+} rda_callgraph_worker_t;
+
+/**
+ * @brief dl_iterate_phdr callback, collect every executable segment.
+ */
+rda_internal int
+collect_call_segments(struct dl_phdr_info* info, size_t size, void* data) {
+    (void) size;
+    for (size_t i = 0; i < info->dlpi_phnum; i++) {
+        const ElfW(Phdr)* phdr = &info->dlpi_phdr[i];
+        if (phdr->p_type != PT_LOAD || !(phdr->p_flags & PF_X) || !phdr->p_memsz)
+            continue;
+        size_t start = info->dlpi_addr + phdr->p_vaddr;
+        rda_callgraph_segment_t segment = { start, start + phdr->p_memsz };
+        callgraph_segment_vec_push(data, &segment);
+    }
+    return 0;
+};
+
+/// @brief order segments by start.
+rda_internal int
+compare_segments(const void* a, const void* b) {
+    const rda_callgraph_segment_t* x = a, * y = b;
+    return (x->start > y->start) - (x->start < y->start);
+};
+
+/// @brief order addresses.
+rda_internal int
+compare_addresses(const void* a, const void* b) {
+    size_t x = *(const size_t*) a, y = *(const size_t*) b;
+    return (x > y) - (x < y);
+};
+
+/// @brief order call sites by caller, then by address.
+rda_internal int
+compare_calls(const void* a, const void* b) {
+    const rda_call_t* x = a, * y = b;
+    if (x->caller != y->caller) return x->caller < y->caller ? -1 : 1;
+    return (x->site > y->site) - (x->site < y->site);
+};
+
+/**
+ * @brief check whether an address is in an executable segment.
+ */
+rda_internal bool
+is_executable(const rda_callgraph_build_t* build, size_t address) {
+    size_t low = 0, high = build->segment_count;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (build->segments[middle].end <= address) low = middle + 1;
+        else high = middle;
+    }
+    return low < build->segment_count && build->segments[low].start <= address;
+};
+
+/**
+ * @brief add a function to the visited set, lock-free.
+ *
+ * @param build the build.
+ * @param address the address of the function.
+ * @return true if it was not visited before (the caller publishes it).
+ */
+rda_internal bool
+visit_function(rda_callgraph_build_t* build, size_t address) {
+    size_t key = address;
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdull;
+    key ^= key >> 33;
+    for (size_t probe = 0; probe <= build->visited_mask; probe++) {
+        atomic_size_t* slot = &build->visited[(key + probe) & build->visited_mask];
+        size_t seen = atomic_load_explicit(slot, memory_order_relaxed);
+        if (!seen && atomic_compare_exchange_strong(slot, &seen, address))
+            return true;
+        if (seen == address)
+            return false;
+    }
+    return false; // full, the budget is exceeded anyway.
+};
+
+/**
+ * @brief add a newly visited function to the frontier.
+ */
+rda_internal void
+publish_function(rda_callgraph_build_t* build, size_t address) {
+    mtx_lock(&build->lock);
+    if (build->published < build->max_functions) {
+        build->functions[build->published++] = address;
+        cnd_signal(&build->frontier);
+    }
+    else build->truncated = true;
+    mtx_unlock(&build->lock);
+};
+
+/**
+ * @brief disassemble a function, to the end of its symbol if it is sized.
+ */
+rda_internal rda_dec_fun_t*
+decode_function(rda_callgraph_build_t* build, size_t address) {
+    const rda_symbol_t* symbol = build->symtab ? rda_symtab_lookup(build->symtab, address) : 0x0;
+    bool arena = rda_get_context().arena != 0x0;
+    if (arena) mtx_lock(&build->decode);
+    rda_dec_fun_t* function;
+    if (symbol && symbol->address == address && symbol->size) {
+        rda_range_policy_t policy = { 0 };
+        function = rda_disassemble_range64((void*) address, symbol->size, &policy);
+    }
+    else function = rda_disassemble64((void*) address);
+    if (arena) mtx_unlock(&build->decode);
+    return function;
+};
+
+/**
+ * @brief disassemble a function of the frontier, record its call sites and
+ *  publish the callees not visited before.
+ *
+ * @param worker the worker.
+ * @param address the address of the function.
+ */
+rda_internal void
+expand_function(rda_callgraph_worker_t* worker, size_t address) {
+    rda_callgraph_build_t* build = worker->build;
+    rda_dec_fun_t* function = decode_function(build, address);
+    if (!function) return;
+
+    for (size_t i = 0; i < function->list.length; i++) {
+        rda_dec_int_t* inst = rda_inst_vec_at(&function->list, i);
+        if (!inst->valid || !(inst->flags & RDA_INST_FL_CALL))
+            continue;
+
+        // the target of a call rel32, or through a plt stub or got slot.
+        size_t site = function->address + (inst->bytes - function->bytes), callee;
+        rda_target_t target;
+        if (build->plt && rda_symtab_target(build->symtab, inst, site, &target))
+            callee = target.resolved;
+        else if (!rda_get_branch_target(inst, site, &callee))
+            continue;
+        if (!is_executable(build, callee))
+            continue;
+
+        rda_call_t call = { address, callee, site };
+        if (!call_vec_push(&worker->calls, &call))
+            worker->failed = true;
+        if (visit_function(build, callee))
+            publish_function(build, callee);
+    }
+    rda_free_function(function);
+};
+
+/**
+ * @brief worker thread, expand the frontier until it is empty and no other
+ *  worker can add to it.
+ */
+rda_internal int
+callgraph_worker(void* data) {
+    rda_callgraph_worker_t* worker = data;
+    rda_callgraph_build_t* build = worker->build;
+    mtx_lock(&build->lock);
+    while (1) {
+        while (build->taken == build->published && build->active)
+            cnd_wait(&build->frontier, &build->lock);
+        if (build->taken == build->published) {
+            cnd_broadcast(&build->frontier);
+            break;
+        }
+        size_t address = build->functions[build->taken++];
+        build->active++;
+        mtx_unlock(&build->lock);
+
+        expand_function(worker, address);
+
+        mtx_lock(&build->lock);
+        build->active--;
+    }
+    mtx_unlock(&build->lock);
+    return 0;
+};
+
+/**
+ * @brief turn the call sites found into the csr arrays of a graph.
+ *
+ * @param graph the graph, with its (ordered) functions.
+ * @param calls the call sites, ordered by caller and site.
+ * @param count the number of <calls>.
+ * @return false if an allocation failed.
+ */
+rda_internal bool
+build_csr(rda_callgraph_t* graph, const rda_call_t* calls, size_t count) {
+    graph->callee_offsets = calloc(graph->count + 1, sizeof *graph->callee_offsets);
+    graph->caller_offsets = calloc(graph->count + 1, sizeof *graph->caller_offsets);
+    graph->callees = malloc((count ? count : 1) * sizeof *graph->callees);
+    graph->sites = malloc((count ? count : 1) * sizeof *graph->sites);
+    graph->callers = malloc((count ? count : 1) * sizeof *graph->callers);
+    unsigned int* edges = malloc((count ? count : 1) * 2 * sizeof *edges);
+    if (!graph->callee_offsets || !graph->caller_offsets || !graph->callees || !graph->sites || !graph->callers || !edges) {
+        free(edges);
+        return false;
+    }
+
+    // resolve both ends of every call site, dropping callees past the budget.
+    for (size_t i = 0; i < count; i++) {
+        size_t caller, callee;
+        if (!rda_callgraph_find(graph, calls[i].caller, &caller) || !rda_callgraph_find(graph, calls[i].callee, &callee))
+            continue;
+        edges[graph->edge_count * 2] = (unsigned int) caller;
+        edges[graph->edge_count * 2 + 1] = (unsigned int) callee;
+        graph->sites[graph->edge_count++] = calls[i].site;
+        graph->callee_offsets[caller + 1]++;
+        graph->caller_offsets[callee + 1]++;
+    }
+    for (size_t i = 0; i < graph->count; i++) {
+        graph->callee_offsets[i + 1] += graph->callee_offsets[i];
+        graph->caller_offsets[i + 1] += graph->caller_offsets[i];
+    }
+
+    // the call sites are already grouped by caller, the callers are scattered by callee.
+    size_t* fill = calloc(graph->count + 1, sizeof *fill);
+    if (!fill) {
+        free(edges);
+        return false;
+    }
+    memcpy(fill, graph->caller_offsets, (graph->count + 1) * sizeof *fill);
+    for (size_t i = 0; i < graph->edge_count; i++) {
+        graph->callees[i] = edges[i * 2 + 1];
+        graph->callers[fill[edges[i * 2 + 1]]++] = edges[i * 2];
+    }
+    free(fill);
+    free(edges);
+    return true;
+};
+
+/**
+ * @brief build the call graph reachable from a set of root functions; every
+ *  function is disassembled exactly once, by a pool of workers expanding the
+ *  frontier in parallel. functions with a sized symbol are decoded to its end,
+ *  others like rda_disassemble64() does; call targets outside executable
+ *  segments are ignored.
+ *
+ * @param roots the root functions.
+ * @param count the number of <roots>.
+ * @param policy how to expand the graph, 0x0 for the defaults.
+ * @return an allocated graph or 0x0 on failure.
+ */
+rda_callgraph_t*
+rda_callgraph_create(void* const* roots, size_t count, const rda_callgraph_policy_t* policy) {
+    if (!roots && count) return 0x0;
+    rda_callgraph_build_t build = {
+        .max_functions = policy && policy->max_functions ? policy->max_functions : RDA_CALLGRAPH_FUNCTIONS,
+        .plt = policy && policy->plt,
+        .symtab = rda_get_symtab(),
+    };
+    size_t workers = policy && policy->workers ? policy->workers : 0;
+    if (!workers) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        workers = online > 0 ? (size_t) online : 1;
+    }
+    if (workers > RDA_CALLGRAPH_WORKERS_MAX) workers = RDA_CALLGRAPH_WORKERS_MAX;
+
+    // the visited set stays at most half full.
+    size_t capacity = 64;
+    while (capacity < build.max_functions * 2) capacity *= 2;
+    build.visited_mask = capacity - 1;
+    build.visited = calloc(capacity, sizeof *build.visited);
+    build.functions = malloc(build.max_functions * sizeof *build.functions);
+    rda_vec_t segments;
+    callgraph_segment_vec_init(&segments, 0x0);
+    dl_iterate_phdr(collect_call_segments, &segments);
+    qsort(callgraph_segment_vec_data(&segments), segments.length, sizeof(rda_callgraph_segment_t), compare_segments);
+    build.segments = callgraph_segment_vec_data(&segments);
+    build.segment_count = segments.length;
+
+    rda_callgraph_worker_t* pool = calloc(workers, sizeof *pool);
+    thrd_t* threads = calloc(workers, sizeof *threads);
+    rda_callgraph_t* graph = calloc(1u, sizeof *graph);
+    if (!build.visited || !build.functions || !pool || !threads || !graph || \
+        mtx_init(&build.lock, mtx_plain) != thrd_success) {
+        free(build.visited);
+        free(build.functions);
+        rda_vec_free(&segments);
+        free(pool);
+        free(threads);
+        free(graph);
+        return 0x0;
+    }
+    cnd_init(&build.frontier);
+    mtx_init(&build.decode, mtx_plain);
+
+    // seed the frontier with the roots.
+    for (size_t i = 0; i < count; i++)
+        if (roots[i] && visit_function(&build, (size_t) roots[i]))
+            publish_function(&build, (size_t) roots[i]);
+
+    // the calling thread is worker 0, the others run on their own threads.
+    size_t started = 1;
+    for (size_t i = 0; i < workers; i++) {
+        pool[i].build = &build;
+        call_vec_init(&pool[i].calls, 0x0);
+    }
+    for (; started < workers; started++)
+        if (thrd_create(&threads[started], callgraph_worker, &pool[started]) != thrd_success)
+            break;
+    callgraph_worker(&pool[0]);
+    bool failed = pool[0].failed;
+    for (size_t i = 1; i < started; i++) {
+        thrd_join(threads[i], 0x0);
+        failed |= pool[i].failed;
+    }
+
+    // gather the call sites, ordered by caller and site.
+    size_t total = 0;
+    for (size_t i = 0; i < workers; i++)
+        total += pool[i].calls.length;
+    rda_call_t* calls = malloc((total ? total : 1) * sizeof *calls);
+    if (calls) {
+        total = 0;
+        for (size_t i = 0; i < workers; i++) {
+            memcpy(calls + total, call_vec_data(&pool[i].calls), pool[i].calls.length * sizeof *calls);
+            total += pool[i].calls.length;
+        }
+        qsort(calls, total, sizeof *calls, compare_calls);
+    }
+
+    // the functions, ordered by address.
+    graph->count = build.published;
+    graph->addresses = build.functions;
+    graph->truncated = build.truncated;
+    qsort(graph->addresses, graph->count, sizeof *graph->addresses, compare_addresses);
+    if (failed || !calls || !build_csr(graph, calls, total)) {
+        rda_callgraph_destroy(graph);
+        graph = 0x0;
+    }
+
+    free(calls);
+    for (size_t i = 0; i < workers; i++)
+        rda_vec_free(&pool[i].calls);
+    free(pool);
+    free(threads);
+    free(build.visited);
+    rda_vec_free(&segments);
+    cnd_destroy(&build.frontier);
+    mtx_destroy(&build.lock);
+    mtx_destroy(&build.decode);
+    return graph;
+};
+
+/**
+ * @brief free a call graph.
+ *
+ * @param graph the graph to be freed.
+ */
+void
+rda_callgraph_destroy(rda_callgraph_t* graph) {
+    if (!graph) return;
+    free(graph->addresses);
+    free(graph->callee_offsets);
+    free(graph->callees);
+    free(graph->sites);
+    free(graph->caller_offsets);
+    free(graph->callers);
+    free(graph);
+};
+
+/**
+ * @brief find a function of a call graph by address.
+ *
+ * @param graph the graph.
+ * @param address the address of the function.
+ * @param index pointer to where the index of the function is written.
+ * @return true if the function is in the graph.
+ */
+bool
+rda_callgraph_find(const rda_callgraph_t* graph, size_t address, size_t* index) {
+    if (!graph || !index) return false;
+    size_t low = 0, high = graph->count;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (graph->addresses[middle] < address) low = middle + 1;
+        else high = middle;
+    }
+    if (low == graph->count || graph->addresses[low] != address) return false;
+    *index = low;
+    return true;
+};
@@ -0,0 +1,32 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file decode.h
+ */
+#ifndef LRDA_DECODE_H
+#define LRDA_DECODE_H
+
+/*! @uses rda_dec_int_t */
+#include "disas.h"
+
+/*! @uses rda_internal */
+#include "lib.h"
+
+/*!
+ * @note the decoder internals shared by the scanners of librda; this header
+ *	is private to src/ and not installed, its functions cannot be linked
+ *	against from outside the library.
+ */
+
+/**
+ * @brief decode a single instruction in memory into <result>, without
+ *  allocating (see disas.c).
+ *
+ * @param bytes the bytes in memory to be decoded.
+ * @param size the size of <bytes>.
+ * @param result the (zeroed) decoded instruction to be written to.
+ */
+rda_internal void
+decode_into(const unsigned char* bytes, size_t size, rda_dec_int_t* result);
+#endif //LRDA_DECODE_H
@@ -0,0 +1,256 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file disarm64.c
+ */
+#include "disarm64.h"
+
+/*! @uses calloc, realloc */
+#include <stdlib.h>
+
+/*! @uses memcpy */
+#include <string.h>
+
+/*! @uses uint64_t, SIZE_MAX */
+#include <stdint.h>
+
+/*! @uses rda_internal, rda_get_context */
+#include "lib.h"
+
+/*! @uses rda_memmap_check, rda_memmap_readable */
+#include "memmap.h"
+
+/*! @uses internal_a64_table, internal_a64_group_table */
+#include "tables.h"
+
+/// @note the number of rows in internal_a64_table.
+#define A64_ROW_COUNT RDA_A64_TABLE_SIZE
+
+/// @note the maximum number of rows a single encoding group can hold (one match bit each).
+#define A64_GROUP_MAX 64
+
+/**
+ * @note the rows of internal_a64_table, split by encoding group (op0) and
+ *  stored as separate mask/value columns so that a group is matched with
+ *  a single branch-free pass over contiguous arrays.
+ */
+typedef struct {
+    unsigned int mask[A64_GROUP_MAX], value[A64_GROUP_MAX];
+    unsigned short row[A64_GROUP_MAX];
+    size_t count;
+} a64_group_t;
+
+/// @note the per-group row columns, built once when the library is loaded.
+static a64_group_t groups[16];
+
+/// @brief build the per-group row columns from internal_a64_table.
+__attribute__((constructor))
+static void
+load_groups() {
+    for (size_t i = 0; i < A64_ROW_COUNT; i++) {
+        const rda_a64_int_t* row = &internal_a64_table[i];
+
+        // a row belongs to every group its op0 bits can match (rows that
+        //  leave some of bits [28:25] open, like the catch-alls, span more than one).
+        unsigned int gmask = (row->mask >> 25) & 0xf, gvalue = (row->value >> 25) & 0xf;
+        for (unsigned int g = 0; g < 16; g++) {
+            if ((g & gmask) != gvalue || groups[g].count == A64_GROUP_MAX)
+                continue;
+            a64_group_t* group = &groups[g];
+            group->mask[group->count] = row->mask;
+            group->value[group->count] = row->value;
+            group->row[group->count++] = (unsigned short) i;
+        }
+    }
+};
+
+/**
+ * @brief classify a single instruction word into <result>.
+ *
+ * @param word the instruction word.
+ * @param result the decoded instruction to be written to.
+ */
+rda_internal void
+classify_word(unsigned int word, rda_dec_a64_int_t* result) {
+    // every row of the group is compared, and the first match is the lowest set bit.
+    const a64_group_t* group = &groups[(word >> 25) & 0xf];
+    uint64_t matches = 0;
+    for (size_t i = 0; i < group->count; i++)
+        matches |= (uint64_t) ((word & group->mask[i]) == group->value[i]) << i;
+
+    result->word = word;
+    result->length = 4u;
+    if (matches) {
+        result->id = group->row[__builtin_ctzll(matches)];
+        result->instruction = internal_a64_table[result->id];
+        result->valid = true;
+
+        // memory accesses based on sp (rn = 31, bits [9:5]) touch the stack.
+        unsigned short flags = result->instruction.flags;
+        bool stack = (flags & (RDA_INST_FL_READ | RDA_INST_FL_WRITE)) && \
+            !(flags & RDA_INST_FL_RIP) && ((word >> 5) & 0x1f) == 0x1f;
+        result->flags = flags | (stack ? RDA_INST_FL_STACK : 0);
+        return;
+    }
+
+    // no row matched, still categorize the word by its encoding group.
+    result->id = RDA_A64_ROW_NONE;
+    result->instruction = (rda_a64_int_t) {
+        .mnemonic = "(unknown)",
+        .type = internal_a64_group_table[(word >> 25) & 0xf],
+    };
+    result->flags = 0;
+    result->valid = false;
+};
+
+/**
+ * @brief read a little-endian instruction word.
+ *
+ * @param bytes the bytes to be read (at least 4).
+ * @return the instruction word.
+ */
+rda_internal unsigned int
+read_word(const unsigned char* bytes) {
+    return (unsigned int) bytes[0] | (unsigned int) bytes[1] << 8 | \
+        (unsigned int) bytes[2] << 16 | (unsigned int) bytes[3] << 24;
+};
+
+/**
+ * @brief decode a single aarch64 instruction in memory.
+ *
+ * @param bytes the bytes in memory to be decoded.
+ * @param size the size of <bytes> (at least 4).
+ * @return a pointer to an allocated structure containing the information
+ *  about the decoded instruction in aarch64, or 0x0 if <size> is less than 4.
+ */
+rda_dec_a64_int_t*
+rda_decode_single_arm64(const unsigned char* bytes, size_t size) {
+    if (!bytes || size < 4) return 0x0;
+
+    rda_dec_a64_int_t* result = calloc(1u, sizeof *result);
+    if (!result) return 0x0;
+    result->bytes = bytes;
+    classify_word(read_word(bytes), result);
+    return result;
+};
+
+/**
+ * @brief decode consecutive aarch64 instructions into a caller provided array,
+ *  without allocating.
+ *
+ * @param bytes the bytes in memory to be decoded.
+ * @param size the size of <bytes>.
+ * @param out the array to be written to.
+ * @param max the capacity of <out>.
+ * @return the number of instructions written to <out>.
+ */
+size_t
+rda_decode_batch_arm64(const unsigned char* bytes, size_t size, rda_dec_a64_int_t* out, size_t max) {
+    if (!bytes || !out) return 0;
+
+    size_t count = size / 4u;
+    if (count > max) count = max;
+    for (size_t i = 0; i < count; i++) {
+        out[i].bytes = bytes + i * 4u;
+        classify_word(read_word(out[i].bytes), &out[i]);
+    }
+    return count;
+};
+
+/**
+ * @brief get the instruction type of decoded aarch64 instruction.
+ *
+ * @param inst a decoded instruction.
+ * @return the category/type of the instruction.
+ */
+rda_int_ty_t
+rda_get_type_arm64(const rda_dec_a64_int_t* inst) {
+    // this should not happen.
+    if (!inst) return RDA_INST_TY_INVALID;
+    return inst->instruction.type;
+};
+
+/**
+ * @brief get the semantic attribute flags of decoded aarch64 instruction.
+ *
+ * @param inst a decoded instruction.
+ * @return the rda_int_fl_t flags of the instruction (0 if invalid).
+ */
+unsigned short
+rda_get_flags_arm64(const rda_dec_a64_int_t* inst) {
+    if (!inst || !inst->valid) return 0;
+    return inst->flags;
+};
+
+/**
+ * @brief disassemble an aarch64 function in memory at an address, stopping
+ *  after the first return, at the first invalid word or at the end of
+ *  readable memory. with rda_context_t::snapshot the words are decoded from
+ *  a private copy, grown a page at a time, otherwise from live memory.
+ *
+ * @param address the address in memory to start reading from.
+ * @return a pointer to an allocated structure containing the information
+ *  about the disassembled function; its list holds rda_dec_a64_int_t.
+ */
+rda_dec_fun_t*
+rda_disassemble_arm64(void* address) {
+    // allocate the structure.
+    rda_dec_fun_t* function = calloc(1u, sizeof *function);
+    function->address = (size_t) address;
+    rda_context_t ctx = rda_get_context();
+    rda_a64_inst_vec_init(&function->list, ctx.arena);
+    function->snapshot = ctx.snapshot;
+
+    // we then iterate, one word at a time, as far as memory is readable.
+    size_t offset = 0, available = 0;
+    rda_memmap_check();
+    size_t limit = rda_memmap_readable(address, SIZE_MAX);
+    const unsigned char* live = address;
+    if (!function->snapshot)
+        function->bytes = address;
+    while (offset + 4u <= limit) {
+        // copy up to the end of the page holding the next word.
+        if (function->snapshot && available - offset < 4u) {
+            size_t end = ((size_t) live + offset + 4u + RDA_PAGE_SIZE - 1) & ~(size_t) (RDA_PAGE_SIZE - 1);
+            size_t size = end - (size_t) live;
+            if (size > limit) size = limit;
+            unsigned char* bytes = realloc(function->bytes, size);
+            if (!bytes) break;
+            memcpy(bytes + available, live + available, size - available);
+            for (size_t i = 0; i < function->list.length; i++) {
+                rda_dec_a64_int_t* inst = rda_a64_inst_vec_at(&function->list, i);
+                inst->bytes = bytes + (inst->bytes - function->bytes);
+            }
+            function->bytes = bytes;
+            available = size;
+        }
+
+        // classify the word straight into the function instruction list.
+        rda_dec_a64_int_t* inst = rda_a64_inst_vec_push(&function->list, 0x0);
+        if (!inst) break; // out of memory
+        inst->bytes = function->bytes + offset;
+        classify_word(read_word(inst->bytes), inst);
+        offset += inst->length;
+
+        // invalid instruction or return, break.
+        if (!inst->valid || (inst->flags & RDA_INST_FL_RET))
+            break;
+    }
+
+    // record total size of bytes consumed
+    function->length = offset;
+    return function;
+};
+
+/**
+ * @brief get the instruction at index within an aarch64 function.
+ *
+ * @param function a function from rda_disassemble_arm64().
+ * @param index the index within the list of instructions.
+ * @return instruction within the function at <index> or 0x0 if not found.
+ */
+rda_dec_a64_int_t*
+rda_get_instruction_at_arm64(rda_dec_fun_t* function, size_t index) {
+    return rda_a64_inst_vec_at(&function->list, index);
+};
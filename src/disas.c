@@ -6,17 +6,32 @@
  */
 #include "disas.h"
 
-/*! @uses calloc */
+/*! @uses calloc, realloc, free */
 #include <stdlib.h>
 
-/*! @uses memcpy, memcmp */
+/*! @uses memcpy, memcmp, strcmp */
 #include <string.h>
 
+/*! @uses SIZE_MAX */
+#include <stdint.h>
+
+/*! @uses call_once, once_flag */
+#include <threads.h>
+
+/*! @uses atomic_load_explicit, atomic_store_explicit, atomic_fetch_add_explicit */
+#include <stdatomic.h>
+
 /*! @uses rda_internal */
 #include "lib.h"
 
-/*! @uses internal_simd_table */
-#include "simdx64.h"
+/*! @uses internal_table, internal_prefix_table, internal_simd_table */
+#include "tables.h"
+
+/*! @uses rda_memmap_check, rda_memmap_readable */
+#include "memmap.h"
+
+/*! @uses decode_into */
+#include "decode.h"
 
 /**
  * @brief parse the prefixes with a max of 5 prefixes.
@@ -119,64 +134,129 @@ get_modrm_length(unsigned char modrm) {
     return length;
 };
 
+/// @note the form bits of a rda_row_t.
+typedef enum {
+    RDA_ROW_FORM_MODRM = 0x1,       // followed by a modr/m byte.
+    RDA_ROW_FORM_PLUS_REG = 0x2,    // +rd encoding, the low 3 bits of the last opcode byte are a register.
+    RDA_ROW_FORM_REX_W = 0x4,       // the imm64 rows, <bytes> spell out rex.w ahead of the opcode.
+    RDA_ROW_FORM_DIGIT = 0x8,       // /digit encoding, the digit is in bits 4-6.
+    RDA_ROW_FORM_MANDATORY = 0x80,  // <bytes> start with a mandatory 66/f2/f3, the last legacy prefix.
+} rda_row_form_fl_t;
+
 /**
- * @brief match, compare, and calculate the bytes for the rda_int_t instruction,
+ * @note the part of a table row the decoder matches on, packed into 8 bytes
+ *	so the rows of both amd64 tables (~4KiB) stay in l1 while decoding; the
+ *	wide rda_int_t row is only read once a row matched.
+ */
+typedef struct {
+    unsigned char bytes[5];         // opcode bytes.
+    unsigned char opcode_length;    // number of <bytes> that are matched.
+    unsigned char immediate;        // immediate length, operand-size dependent ones resolved.
+    unsigned char form;             // rda_row_form_fl_t, and the /digit.
+} rda_row_t;
+
+/// @note the match rows of internal_table then internal_simd_table, indexed like rda_profile_t::hits.
+static rda_row_t g_rows[RDA_PROFILE_ROWS];
+
+/**
+ * @brief pack the match rows of a table.
+ *
+ * @param rows the match rows to be written to.
+ * @param table the table rows.
+ * @param count the count of <table>.
+ */
+rda_internal void
+pack_rows(rda_row_t* rows, const rda_int_t* table, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        const rda_int_t* inst = &table[i];
+        rda_row_t* row = &rows[i];
+        memcpy(row->bytes, inst->bytes, sizeof row->bytes);
+        row->opcode_length = (unsigned char) inst->opcode_length;
+
+        // immediate values, the operand-size dependent ones (-1) are imm16 or
+        //  (sign-extended in 64-bit mode) imm32.
+        if (inst->instruction_length > 0)
+            row->immediate = (unsigned char) inst->instruction_length;
+        else if (inst->instruction_length == -1)
+            row->immediate = inst->opcode_size == 16 ? 2 : 4;
+
+        if (inst->modrm) row->form |= RDA_ROW_FORM_MODRM;
+        if (inst->plus_reg) row->form |= RDA_ROW_FORM_PLUS_REG;
+        if (RDA_INT_REX_W(*inst))
+            row->form |= RDA_ROW_FORM_REX_W;
+        if (inst->modrm_reg != -1)
+            row->form |= (unsigned char) (RDA_ROW_FORM_DIGIT | (inst->modrm_reg & 7) << 4);
+        if (RDA_INT_MANDATORY(*inst))
+            row->form |= RDA_ROW_FORM_MANDATORY;
+    }
+};
+
+/**
+ * @brief match, compare, and calculate the bytes for a table row,
  *  returning the length if they match, and -1 otherwise.
  *
  * @param bytes the bytes to be matched.
  * @param available the number of available bytes.
- * @param inst the amd64 instruction to compare against.
+ * @param row the match row to compare against.
  * @param prefix_len the size of the prefix to compare and calculate against.
  * @return the length of bytes read, -1 if they do not match.
  */
 rda_internal int
 match_and_calc_length(const unsigned char* bytes, size_t available,
-    const rda_int_t* inst, size_t prefix_len) {
+    const rda_row_t* row, size_t prefix_len) {
     // grabbing a pointer to the current byte from the code + prefix_len.
     const unsigned char* byte_ptr = bytes + prefix_len;
     size_t remaining = available - prefix_len;
-    if (remaining < inst->opcode_length) return -1; // not enough bytes for opcode
+    if (remaining < row->opcode_length) return -1; // not enough bytes for opcode
 
+    // a mandatory prefix is parsed as a legacy prefix, the last one (before any rex).
+    if (row->form & RDA_ROW_FORM_MANDATORY) {
+        size_t at = prefix_len && (bytes[prefix_len - 1] & 0xf0) == 0x40 ? prefix_len - 1 : prefix_len;
+        if (!at || bytes[at - 1] != row->bytes[0] || remaining < row->opcode_length - 1u || \
+            memcmp(byte_ptr, row->bytes + 1, row->opcode_length - 1u) != 0)
+            return -1;
+        prefix_len--;
+    }
     // quick opcode matching
-    if (inst->plus_reg) {
+    else if (row->form & RDA_ROW_FORM_PLUS_REG) {
         // +rd encoding - mask lower 3 bits of last opcode byte
-        if (inst->opcode_length == 1) {
-            // if rex.w
-            if (prefix_len == 1 && inst->opcode_size == 64) {
-                if (bytes[0] != 0x48)
+        if (row->opcode_length == 1) {
+            // the imm64 rows spell out rex.w ahead of their opcode, any rex with w
+            //  set (rex.b only picks r8-r15) matches them.
+            if (row->form & RDA_ROW_FORM_REX_W) {
+                if (!prefix_len || (bytes[prefix_len - 1] & 0xf8) != 0x48)
                     return -1;
-                if (bytes[1] != inst->bytes[1])
+                if (byte_ptr[0] != row->bytes[1])
                     return -1;
             }
-            else if ((byte_ptr[0] & 0xf8) != (inst->bytes[0] & 0xf8))
+            // otherwise a rex prefix only extends the register in the low 3 bits.
+            else if ((byte_ptr[0] & 0xf8) != (row->bytes[0] & 0xf8))
                 return -1;
         }
         else {
-            if (memcmp(byte_ptr, inst->bytes, inst->opcode_length - 1) != 0) return -1;
-            if ((byte_ptr[inst->opcode_length - 1] & 0xf8) != \
-                (inst->bytes[inst->opcode_length - 1] & 0xf8)) {
+            if (memcmp(byte_ptr, row->bytes, row->opcode_length - 1) != 0) return -1;
+            if ((byte_ptr[row->opcode_length - 1] & 0xf8) != \
+                (row->bytes[row->opcode_length - 1] & 0xf8)) {
                 return -1;
             }
         }
     } else {
-        // exact match
-        if (memcmp(byte_ptr, inst->bytes, inst->opcode_length) != 0)
+        // exact match, most rows are rejected on their first byte.
+        if (byte_ptr[0] != row->bytes[0] || memcmp(byte_ptr, row->bytes, row->opcode_length) != 0)
             return -1;
     }
 
     // set the bare minimum length to be equal to
-    int length = (int) prefix_len + inst->opcode_length;
+    int length = (int) prefix_len + row->opcode_length;
 
     // handle modr/m byte
-    if (inst->modrm) {
+    if (row->form & RDA_ROW_FORM_MODRM) {
         if (length >= available) return -1;
         unsigned char modrm = bytes[length];
 
         // check /digit encoding
-        if (inst->modrm_reg != -1) {
-            unsigned char reg = (modrm >> 3) & 7;
-            if (reg != inst->modrm_reg) return -1;
-        }
+        if ((row->form & RDA_ROW_FORM_DIGIT) && ((modrm >> 3) & 7) != ((row->form >> 4) & 7))
+            return -1;
 
         // calculate the modrm length, and if it is more than we have
         //  available, then we simply return -1.
@@ -186,40 +266,332 @@ match_and_calc_length(const unsigned char* bytes, size_t available,
     }
 
     // handle immediate values
-    if (inst->instruction_length > 0) {
-        length += inst->instruction_length;
-    } else if (inst->instruction_length == -1) {
-        // operand-size dependent
-        if (inst->opcode_size == 64) {
-            length += 4; // usually sign-extended 32-bit in 64-bit mode
-        } else if (inst->opcode_size == 32) {
-            length += 4;
-        } else if (inst->opcode_size == 16) {
-            length += 2;
-        } else {
-            length += 4; // default
+    length += row->immediate;
+    return (length <= available) ? length : -1;
+};
+
+/**
+ * @brief refine the precomputed flags of a row for an actual encoding;
+ *  register r/m operands do not access memory, and mod 00 r/m 101 is rip-relative.
+ *
+ * @param inst the matched amd64 instruction.
+ * @param bytes the bytes of the instruction, past any prefixes.
+ * @return the flags of this instance.
+ */
+rda_internal unsigned short
+get_instance_flags(const rda_int_t* inst, const unsigned char* bytes) {
+    unsigned short flags = inst->flags;
+    if (!inst->modrm)
+        return flags;
+
+    unsigned char modrm = bytes[inst->opcode_length];
+    if ((modrm >> 6) == 3)
+        flags &= ~(RDA_INST_FL_READ | RDA_INST_FL_WRITE);
+    else if ((modrm & 0xc7) == 0x05)
+        flags |= RDA_INST_FL_RIP;
+    return flags;
+};
+
+
+/// @note the number of candidates a decoder can have, a +rd row is a candidate of 8 opcode bytes.
+#define RDA_DECODER_ROWS (RDA_PROFILE_ROWS * 8)
+
+/**
+ * @note an amd64 decoder specialized for a combination of isa profiles: the
+ *	rows that can match every opcode byte (past the prefixes), the simd rows
+ *	of those profiles before the main table, in table order or the order of a
+ *	profile (see order_candidates()).
+ */
+typedef struct rda_decoder {
+    unsigned short first[257];              // the candidates of byte b are rows[first[b]] to rows[first[b + 1] - 1].
+    unsigned short rows[RDA_DECODER_ROWS];  // indices into g_rows.
+    unsigned int isa;                       // the rda_isa_fl_t profiles of its simd rows.
+    struct rda_decoder* next;               // the decoder ordered before this one, see rda_select_decoder().
+} rda_decoder_t;
+
+/// @note a decoder for every combination of profiles in table order, built once.
+static rda_decoder_t g_decoders[RDA_ISA_ALL + 1];
+static once_flag g_decoders_once = ONCE_FLAG_INIT;
+
+/// @note the decoders ordered by a profile, kept until unload (other threads may still use them).
+static rda_decoder_t* _Atomic g_ordered;
+
+/// @note the decoder selected by rda_begin(), 0x0 (the baseline decoder) before it.
+static const rda_decoder_t* _Atomic g_decoder;
+
+/// @note the matches of every row while learning, see rda_context_t::learn.
+static atomic_uint g_hits[RDA_PROFILE_ROWS];
+static atomic_bool g_learn;
+
+/**
+ * @brief get the isa profile a simd row belongs to.
+ *
+ * @param row a row of internal_simd_table.
+ * @return one of rda_isa_fl_t.
+ */
+rda_internal unsigned int
+get_row_profile(const rda_int_t* row) {
+    if (row->vex_encoding == 2 || row->type == RDA_INST_TY_AVX512)
+        return RDA_ISA_AVX512;
+    if (row->vex_encoding == 1 || row->type == RDA_INST_TY_AVX || row->type == RDA_INST_TY_AVX2)
+        return RDA_ISA_AVX;
+    return RDA_ISA_SSE;
+};
+
+/**
+ * @brief check whether match_and_calc_length() could accept a row with an
+ *  opcode byte (the first byte past the prefixes); rda::accepts_opcode() in
+ *  rda.hpp mirrors it, and its static_asserts check the two agree.
+ */
+rda_internal bool
+accepts_opcode(const rda_row_t* row, unsigned char byte) {
+    if (row->form & RDA_ROW_FORM_MANDATORY)
+        return byte == row->bytes[1];
+    if ((row->form & RDA_ROW_FORM_PLUS_REG) && row->opcode_length == 1) {
+        if (row->form & RDA_ROW_FORM_REX_W)
+            return byte == row->bytes[1];
+        return (byte & 0xf8) == (row->bytes[0] & 0xf8);
+    }
+    return byte == row->bytes[0];
+};
+
+/**
+ * @brief get the length of the vex/evex prefix (with the opcode) an escape
+ *  byte starts; les, lds and bound are invalid in 64-bit mode, so c4, c5 and
+ *  62 always start one.
+ *
+ * @param byte the opcode byte (the first byte past the prefixes).
+ * @return the length, 0 if <byte> is not a vex/evex escape.
+ */
+rda_internal size_t
+get_escape_length(unsigned char byte) {
+    return byte == 0xc5 ? 3u : byte == 0xc4 ? 4u : byte == 0x62 ? 5u : 0u;
+};
+
+/**
+ * @brief check whether two candidates of an opcode byte could match the same
+ *  encoding, so that their table order decides between them; conservative.
+ */
+rda_internal bool
+rows_overlap(const rda_row_t* a, const rda_row_t* b) {
+    if ((a->form | b->form) & (RDA_ROW_FORM_REX_W | RDA_ROW_FORM_MANDATORY))
+        return true;
+
+    // an opcode byte both compare, and differ in.
+    size_t length = a->opcode_length < b->opcode_length ? a->opcode_length : b->opcode_length;
+    for (size_t i = 0; i < length; i++) {
+        unsigned char mask = 0xff;
+        if ((a->form & RDA_ROW_FORM_PLUS_REG) && i + 1 == a->opcode_length) mask &= 0xf8;
+        if ((b->form & RDA_ROW_FORM_PLUS_REG) && i + 1 == b->opcode_length) mask &= 0xf8;
+        if ((a->bytes[i] ^ b->bytes[i]) & mask)
+            return false;
+    }
+
+    // or another /digit of the same opcode.
+    unsigned char digit = RDA_ROW_FORM_MODRM | RDA_ROW_FORM_DIGIT;
+    return a->opcode_length != b->opcode_length || (a->form & digit) != digit || \
+        (b->form & digit) != digit || ((a->form >> 4) & 7) == ((b->form >> 4) & 7);
+};
+
+/**
+ * @brief order the candidates of an opcode byte by how often they matched,
+ *  most first; a candidate never moves ahead of an earlier one it overlaps
+ *  with, so the order changes how fast, never what, an encoding decodes to.
+ *
+ * @param rows the candidates, in table order.
+ * @param count the number of <rows>.
+ * @param hits the matches of every row.
+ */
+rda_internal void
+order_candidates(unsigned short* rows, size_t count, const unsigned int* hits) {
+    unsigned short ordered[RDA_PROFILE_ROWS];
+    bool placed[RDA_PROFILE_ROWS] = { 0 };
+    for (size_t out = 0; out < count; out++) {
+        // the most frequent candidate with no earlier overlapping one left (the first left always qualifies).
+        size_t best = count;
+        for (size_t j = 0; j < count; j++) {
+            if (placed[j] || (best < count && hits[rows[j]] <= hits[rows[best]]))
+                continue;
+            bool ready = true;
+            for (size_t k = 0; k < j && ready; k++)
+                ready = placed[k] || !rows_overlap(&g_rows[rows[k]], &g_rows[rows[j]]);
+            if (ready) best = j;
         }
+        placed[best] = true;
+        ordered[out] = rows[best];
     }
-    return (length <= available) ? length : -1;
+    memcpy(rows, ordered, count * sizeof *rows);
 };
 
 /**
- * @brief decode a single instruction in memory.
+ * @brief build a decoder.
+ *
+ * @param decoder the decoder to be written to.
+ * @param isa the rda_isa_fl_t profiles of its simd rows.
+ * @param hits the matches of every row to order the candidates by, 0x0 for table order.
+ */
+rda_internal void
+build_decoder(rda_decoder_t* decoder, unsigned int isa, const unsigned int* hits) {
+    // a vex/evex escape only has the rows that spell out its whole prefix, the
+    //  generic rows are left to decode_vector(); the rows with a mandatory
+    //  prefix go first, the others would match them with a plain 66/f2/f3.
+    size_t count = 0;
+    decoder->isa = isa;
+    for (unsigned int byte = 0; byte < 256; byte++) {
+        size_t start = decoder->first[byte] = (unsigned short) count;
+        size_t escape = get_escape_length((unsigned char) byte);
+        for (int mandatory = 1; mandatory >= 0; mandatory--)
+            for (size_t i = RDA_INT_TABLE_SIZE; i < RDA_INT_TABLE_SIZE + RDA_INT_SIMD_VECTOR_FIRST; i++)
+                if ((get_row_profile(&internal_simd_table[i - RDA_INT_TABLE_SIZE]) & isa) && \
+                    !(g_rows[i].form & RDA_ROW_FORM_MANDATORY) == !mandatory && \
+                    accepts_opcode(&g_rows[i], (unsigned char) byte) && g_rows[i].opcode_length >= escape)
+                    decoder->rows[count++] = (unsigned short) i;
+        for (size_t i = 0; i < RDA_INT_TABLE_SIZE && !escape; i++)
+            if (accepts_opcode(&g_rows[i], (unsigned char) byte))
+                decoder->rows[count++] = (unsigned short) i;
+        if (hits) order_candidates(decoder->rows + start, count - start, hits);
+    }
+    decoder->first[256] = (unsigned short) count;
+};
+
+/// @brief pack the match rows and build the decoder of every combination of profiles.
+rda_internal void
+build_decoders(void) {
+    pack_rows(g_rows, internal_table, RDA_INT_TABLE_SIZE);
+    pack_rows(g_rows + RDA_INT_TABLE_SIZE, internal_simd_table, RDA_INT_SIMD_TABLE_SIZE);
+    for (unsigned int profile = 0; profile <= RDA_ISA_ALL; profile++)
+        build_decoder(&g_decoders[profile], profile, 0x0);
+};
+
+/// @brief free the decoders ordered by a profile.
+__attribute__((destructor)) static void
+free_decoders(void) {
+    rda_decoder_t* decoder = atomic_exchange(&g_ordered, 0x0);
+    while (decoder) {
+        rda_decoder_t* next = decoder->next;
+        free(decoder);
+        decoder = next;
+    }
+};
+
+/**
+ * @brief select the amd64 decoder specialized for the isa profiles of a
+ *  context, ordered by its decode profile if any, called by rda_begin().
+ *
+ * @param ctx the new context.
+ */
+rda_internal void
+rda_select_decoder(rda_context_t ctx) {
+    call_once(&g_decoders_once, build_decoders);
+    unsigned int profile = ctx.use_simd ? (ctx.isa ? ctx.isa & RDA_ISA_ALL : RDA_ISA_ALL) : RDA_ISA_BASELINE;
+
+    // a learning phase starts from zero.
+    if (ctx.learn)
+        for (size_t i = 0; i < RDA_PROFILE_ROWS; i++)
+            atomic_store_explicit(&g_hits[i], 0u, memory_order_relaxed);
+    atomic_store_explicit(&g_learn, ctx.learn, memory_order_relaxed);
+
+    const rda_decoder_t* decoder = &g_decoders[profile];
+    if (ctx.profile && ctx.profile->rows == RDA_PROFILE_ROWS) {
+        rda_decoder_t* ordered = calloc(1u, sizeof *ordered);
+        if (ordered) {
+            build_decoder(ordered, profile, ctx.profile->hits);
+            ordered->next = atomic_exchange(&g_ordered, ordered);
+            decoder = ordered;
+        }
+    }
+    atomic_store_explicit(&g_decoder, decoder, memory_order_release);
+};
+
+/**
+ * @brief get the decode profile learned since the last rda_begin() with
+ *  rda_context_t::learn set.
+ *
+ * @param profile pointer to where the profile is written.
+ */
+void
+rda_get_profile(rda_profile_t* profile) {
+    if (!profile) return;
+    profile->rows = RDA_PROFILE_ROWS;
+    for (size_t i = 0; i < RDA_PROFILE_ROWS; i++)
+        profile->hits[i] = atomic_load_explicit(&g_hits[i], memory_order_relaxed);
+};
+
+/**
+ * @brief decode a vex/evex instruction no named row matched from its prefix
+ *  alone: its length, and its vector length (vex.l, evex.l'l, or 512 bits
+ *  for evex embedded rounding) into a generic row.
+ *
+ * @param bytes the bytes of the instruction.
+ * @param size the size of <bytes>.
+ * @param prefix_length the length of the legacy prefixes.
+ * @param isa the rda_isa_fl_t profiles of the decoder.
+ * @param result the decoded instruction to be written to.
+ * @return false if the prefix is malformed, truncated or not in <isa>.
+ */
+rda_internal bool
+decode_vector(const unsigned char* bytes, size_t size, size_t prefix_length, unsigned int isa,
+    rda_dec_int_t* result) {
+    const unsigned char* p = bytes + prefix_length;
+    size_t escape = get_escape_length(p[0]);
+    if (size - prefix_length <= escape) return false;
+
+    // the opcode map (0f, 0f38, 0f3a) and the generic row of the vector length.
+    unsigned int map, row;
+    if (p[0] == 0x62) {
+        if (!(isa & RDA_ISA_AVX512) || (p[1] & 0x0c) || !(p[2] & 0x04)) return false;
+        map = p[1] & 0x03u;
+        unsigned int ll = (p[3] >> 5) & 3u;
+        if ((p[3] & 0x10) && (p[escape] >> 6) == 3) ll = 2; // embedded rounding.
+        if (ll == 3) return false;
+        row = 2u + ll;
+    }
+    else {
+        if (!(isa & RDA_ISA_AVX)) return false;
+        map = p[0] == 0xc5 ? 1u : p[1] & 0x1fu;
+        row = (p[escape - 2] & 0x04) ? 1u : 0u;
+    }
+    if (map < 1 || map > 3) return false;
+
+    // vzeroupper/vzeroall have no modr/m, 0f3a and the 0f shuffles, shifts and compares an imm8.
+    unsigned char opcode = p[escape - 1];
+    size_t length = prefix_length + escape;
+    if (map != 1 || opcode != 0x77) {
+        length += get_modrm_length(bytes[length]);
+        if (length > size) return false;
+    }
+    if (map == 3 || (map == 1 && ((opcode >= 0x70 && opcode <= 0x73) || (opcode >= 0xc2 && opcode <= 0xc6))))
+        length++;
+    if (length > size || length > 15) return false;
+
+    size_t i = RDA_INT_TABLE_SIZE + RDA_INT_SIMD_VECTOR_FIRST + row;
+    if (atomic_load_explicit(&g_learn, memory_order_relaxed))
+        atomic_fetch_add_explicit(&g_hits[i], 1u, memory_order_relaxed);
+    result->instruction = &internal_simd_table[RDA_INT_SIMD_VECTOR_FIRST + row];
+    result->id = (unsigned short) (RDA_ROW_SIMD | (RDA_INT_SIMD_VECTOR_FIRST + row));
+    result->flags = (map != 1 || opcode != 0x77) && (bytes[prefix_length + escape] & 0xc7) == 0x05 ? RDA_INST_FL_RIP : 0;
+    result->bytes = bytes;
+    result->length = length;
+    result->prefix_count = prefix_length;
+    result->vex_encoding = p[0] == 0x62 ? 2 : 1;
+    result->valid = true;
+    return true;
+};
+
+/**
+ * @brief decode a single instruction in memory into <result>.
  *
  * @param bytes the bytes in memory to be decoded.
- * @param size the size of <bytes> (at the most 4).
- * @return a pointer to an allocated structure containing the information
- *  about the decoded instruction in amd64.
+ * @param size the size of <bytes>.
+ * @param result the (zeroed) decoded instruction to be written to.
  */
-rda_dec_int_t*
-rda_decode_single64(const unsigned char* bytes, size_t size) {
-    // allocate a instruction and then return it.
-    rda_dec_int_t* result = calloc(1u, sizeof *result);
+rda_internal void
+decode_into(const unsigned char* bytes, size_t size, rda_dec_int_t* result) {
+    result->instruction = &internal_invalid_row;
     if (!bytes || size == 0) {
         result->valid = false;
-        return result; // we want to fail silently, this is a shared object after all.
+        return; // we want to fail silently, this is a shared object after all.
     }
-
     // special handling for 0xf3 prefix vs. endbr32/64 instructions,
     size_t prefix_length = 0;
     unsigned char rex = 0;
@@ -233,53 +605,121 @@ rda_decode_single64(const unsigned char* bytes, size_t size) {
 
     // this should never happen.
     if (prefix_length >= size) {
-        return result; // only prefixes, no instruction
+        return; // only prefixes, no instruction
     }
 
-    // try simd instruction table first,
-    rda_context_t ctx = rda_get_context();
-    if (ctx.use_simd) {
-        for (size_t i = 0; i < sizeof(internal_simd_table) / sizeof(rda_int_t); i++) {
-            // iterate through each instruction and see if anything remotely matches.
-            const rda_int_t* inst = &internal_simd_table[i];
-            int length = match_and_calc_length(bytes, size, inst, prefix_length);
-            if (length > 0) {
-                // found a simd match!
-                result->instruction = *inst;
-                result->bytes = bytes;
-                result->length = length;
-                result->prefix_count = prefix_length;
-                result->rex_byte = rex;
-                result->valid = true;
-                return result;
-            }
-        }
+    // the decoder selected by rda_begin(), or the baseline one.
+    const rda_decoder_t* decoder = atomic_load_explicit(&g_decoder, memory_order_acquire);
+    if (!decoder) {
+        call_once(&g_decoders_once, build_decoders);
+        decoder = &g_decoders[RDA_ISA_BASELINE];
+        const rda_decoder_t* expected = 0x0;
+        if (!atomic_compare_exchange_strong(&g_decoder, &expected, decoder))
+            decoder = expected;
     }
 
-    // we then try the main instruction table.
-    for (size_t i = 0; i < sizeof(internal_table) / sizeof(rda_int_t); i++) {
-        // iterate through each instruction and see if anything remotely matches.
-        const rda_int_t* inst = &internal_table[i];
-        int length = match_and_calc_length(bytes, size, inst, prefix_length);
+    // try the candidates of the opcode byte, in the order of the decoder.
+    unsigned char opcode = bytes[prefix_length];
+    for (size_t k = decoder->first[opcode]; k < decoder->first[opcode + 1]; k++) {
+        size_t i = decoder->rows[k];
+        int length = match_and_calc_length(bytes, size, &g_rows[i], prefix_length);
         if (length > 0) {
             // found a match!
-            result->instruction = *inst;
+            bool simd = i >= RDA_INT_TABLE_SIZE;
+            const rda_int_t* inst = simd ? &internal_simd_table[i - RDA_INT_TABLE_SIZE] : &internal_table[i];
+            if (atomic_load_explicit(&g_learn, memory_order_relaxed))
+                atomic_fetch_add_explicit(&g_hits[i], 1u, memory_order_relaxed);
+            // a mandatory prefix is counted as part of the opcode bytes, as the row spells it.
+            size_t prefix_count = prefix_length - ((g_rows[i].form & RDA_ROW_FORM_MANDATORY) != 0);
+            result->instruction = inst;
+            result->id = (unsigned short) (simd ? RDA_ROW_SIMD | (i - RDA_INT_TABLE_SIZE) : i);
+            result->flags = get_instance_flags(inst, bytes + prefix_count);
             result->bytes = bytes;
             result->length = length;
-            result->prefix_count = prefix_length;
+            result->prefix_count = prefix_count;
             result->rex_byte = rex;
             result->valid = true;
-            return result;
+            return;
         }
     }
 
+    // a vex/evex instruction without a named row.
+    if (get_escape_length(opcode) && decode_vector(bytes, size, prefix_length, decoder->isa, result))
+        return;
+
     // no match found, this instruction is 'unrecognized'.
     result->bytes = bytes;
     result->length = 1; // skip one byte
     result->valid = false;
+};
+
+/**
+ * @brief decode a single instruction in memory.
+ *
+ * @param bytes the bytes in memory to be decoded.
+ * @param size the size of <bytes>, clamped to the readable memory at <bytes>.
+ * @return a pointer to an allocated structure containing the information
+ *  about the decoded instruction in amd64.
+ */
+rda_dec_int_t*
+rda_decode_single64(const unsigned char* bytes, size_t size) {
+    // allocate a instruction and then return it.
+    rda_dec_int_t* result = calloc(1u, sizeof *result);
+    if (result) decode_into(bytes, rda_memmap_readable(bytes, size), result);
     return result;
 };
 
+/**
+ * @brief get the table row for a row id.
+ *
+ * @param id the row id of a decoded instruction.
+ * @return the row in internal_table/internal_simd_table or 0x0 if <id> is out of range.
+ */
+const rda_int_t*
+rda_get_row(unsigned short id) {
+    size_t index = id & ~RDA_ROW_SIMD;
+    if (id & RDA_ROW_SIMD)
+        return index < RDA_INT_SIMD_TABLE_SIZE ? &internal_simd_table[index] : 0x0;
+    return index < RDA_INT_TABLE_SIZE ? &internal_table[index] : 0x0;
+};
+
+/**
+ * @brief get the row id of a mnemonic template (e.g. "call r/m64").
+ *
+ * @param mnemonic the exact mnemonic template of a row.
+ * @param id pointer to where the row id is written.
+ * @return true if a row with <mnemonic> exists.
+ */
+bool
+rda_get_row_id(const char* mnemonic, unsigned short* id) {
+    if (!mnemonic || !id) return false;
+    for (size_t i = 0; i < RDA_INT_TABLE_SIZE; i++) {
+        if (strcmp(internal_table[i].mnemonic, mnemonic) == 0) {
+            *id = (unsigned short) i;
+            return true;
+        }
+    }
+    for (size_t i = 0; i < RDA_INT_SIMD_TABLE_SIZE; i++) {
+        if (strcmp(internal_simd_table[i].mnemonic, mnemonic) == 0) {
+            *id = (unsigned short) (RDA_ROW_SIMD | i);
+            return true;
+        }
+    }
+    return false;
+};
+
+/**
+ * @brief get the semantic attribute flags of decoded instruction.
+ *
+ * @param inst a decoded instruction.
+ * @return the rda_int_fl_t flags of the instruction (0 if invalid).
+ */
+unsigned short
+rda_get_flags(const rda_dec_int_t* inst) {
+    if (!inst || !inst->valid) return 0;
+    return inst->flags;
+};
+
 /**
  * @brief get the instruction type of decoded instruction.
  *
@@ -289,12 +729,67 @@ rda_decode_single64(const unsigned char* bytes, size_t size) {
 rda_int_ty_t
 rda_get_type(const rda_dec_int_t* inst) {
     // this should not happen.
-    if (!inst) return RDA_INST_TY_INVALID;
-    return inst->instruction.type;
+    if (!inst || !inst->instruction) return RDA_INST_TY_INVALID;
+    return inst->instruction->type;
+};
+
+/**
+ * @brief grow the snapshot of a function so that at least 15 bytes (the longest
+ *  instruction) follow <offset>, copying up to the end of the page they end on,
+ *  which is a page a live decode would touch as well, but never past <limit>.
+ *
+ * @param function the function being disassembled.
+ * @param live the live address of the function.
+ * @param offset the offset of the next instruction.
+ * @param limit the byte budget of the function.
+ * @param available pointer to the number of bytes in the snapshot.
+ * @return false if the allocation failed or the budget is used up.
+ */
+rda_internal bool
+grow_snapshot(rda_dec_fun_t* function, const unsigned char* live, size_t offset, size_t limit, size_t* available) {
+    size_t end = ((size_t) live + offset + 15 + RDA_PAGE_SIZE - 1) & ~(size_t) (RDA_PAGE_SIZE - 1);
+    size_t size = end - (size_t) live;
+    if (size > limit) size = limit;
+    if (size <= *available) return false;
+    unsigned char* bytes = realloc(function->bytes, size);
+    if (!bytes) return false;
+    memcpy(bytes + *available, live + *available, size - *available);
+
+    // the instructions decoded so far must point into the (moved) snapshot.
+    for (size_t i = 0; i < function->list.length; i++) {
+        rda_dec_int_t* inst = rda_inst_vec_at(&function->list, i);
+        inst->bytes = bytes + (inst->bytes - function->bytes);
+    }
+    function->bytes = bytes;
+    *available = size;
+    return true;
 };
 
 /**
- * @brief disassemble a function in memory at an address.
+ * @brief check whether an instruction is padding between functions: int3, or
+ *  a nop that cannot be reached by falling through.
+ *
+ * @param inst the decoded instruction.
+ * @param previous the flags of the instruction before it.
+ * @return true if <inst> is padding.
+ */
+rda_internal bool
+is_padding(const rda_dec_int_t* inst, unsigned short previous) {
+    if (!inst->valid || (inst->id & RDA_ROW_SIMD))
+        return false;
+    const rda_int_t* row = inst->instruction;
+    if (row->opcode_length == 1 && row->bytes[0] == 0xcc)
+        return true;
+    bool nop = (row->opcode_length == 1 && row->bytes[0] == 0x90) || \
+        (row->opcode_length == 2 && row->bytes[0] == 0x0f && row->bytes[1] == 0x1f);
+    return nop && (previous & RDA_INST_FL_TERM);
+};
+
+/**
+ * @brief disassemble a function in memory at an address; by default the
+ *  function is a zero-copy view of live memory, with rda_context_t::snapshot
+ *  the bytes are copied once up front and every instruction refers to the copy.
+ *  decoding stops at the end of readable memory.
  *
  * @param address the address in memory to start reading from.
  * @return a pointer to an allocated structure containing the information
@@ -302,41 +797,112 @@ rda_get_type(const rda_dec_int_t* inst) {
  */
 rda_dec_fun_t*
 rda_disassemble64(void* address) {
+    rda_range_policy_t policy = { .stop = RDA_STOP_RET };
+    return rda_disassemble_range64(address, 0, &policy);
+};
+
+/**
+ * @brief disassemble at most <max_bytes> bytes at an address, stopping at the
+ *  first invalid instruction or when <policy> says so; the decoder is never
+ *  given bytes past the budget or the end of readable memory (see memmap.h),
+ *  and an instruction that does not fit in them is not included.
+ *
+ * @param address the address in memory to start reading from.
+ * @param max_bytes the byte budget, 0 for none.
+ * @param policy the stop conditions, 0x0 to stop after a return.
+ * @return a pointer to an allocated structure containing the information
+ *  about the disassembled function in amd64.
+ */
+rda_dec_fun_t*
+rda_disassemble_range64(void* address, size_t max_bytes, const rda_range_policy_t* policy) {
+    rda_range_policy_t stop_on_ret = { .stop = RDA_STOP_RET };
+    if (!policy) policy = &stop_on_ret;
+
+    // the byte budget is the tighter of <max_bytes> and the end address.
+    size_t limit = max_bytes ? max_bytes : SIZE_MAX;
+    if (policy->end) {
+        size_t until = policy->end > (size_t) address ? policy->end - (size_t) address : 0;
+        if (until < limit) limit = until;
+    }
+
+    // nor reach past the end of the readable memory at <address>, as mapped now.
+    rda_memmap_check();
+    limit = rda_memmap_readable(address, limit);
+
     // allocate the structure.
     rda_dec_fun_t* function = calloc(1u, sizeof *function);
     function->address = (size_t) address;
-    function->list = rda_dynl_create(sizeof(rda_dec_int_t));
+    rda_context_t ctx = rda_get_context();
+    rda_inst_vec_init(&function->list, ctx.arena);
+    function->snapshot = ctx.snapshot;
+
+    // decode straight from live memory, or from a snapshot grown as we go.
+    size_t offset = 0, available = 0;
+    unsigned short previous = 0;
+    const unsigned char* live = address;
+    if (!function->snapshot)
+        function->bytes = address;
+    while (offset < limit) {
+        if (policy->max_instructions && function->list.length == policy->max_instructions)
+            break;
+        if (function->snapshot && available - offset < 15 && available < limit && \
+            !grow_snapshot(function, live, offset, limit, &available))
+            break;
 
-    // we then iterate.
-    size_t offset = 0;
-    unsigned char* bytes = address;
-    while (1) {
-        // decode instruction at current offset
-        rda_dec_int_t* inst = rda_decode_single64(bytes + offset, 15);
-        if (!inst) break; // decoder failed badly
+        // decode instruction at current offset, straight into the function instruction list.
+        size_t size = (function->snapshot ? available : limit) - offset;
+        rda_dec_int_t* inst = rda_inst_vec_push(&function->list, 0x0);
+        if (!inst) break; // out of memory
+        decode_into(function->bytes + offset, size < 15 ? size : 15, inst);
 
-        // add to a function instruction list.
-        rda_dynl_push(function->list, inst);
+        // an invalid instruction at the end of the budget may just not fit, drop it.
+        if (!inst->valid && size < 15) {
+            function->list.length--;
+            break;
+        }
+
+        // padding ends the function before it.
+        if ((policy->stop & RDA_STOP_PADDING) && is_padding(inst, previous)) {
+            function->list.length--;
+            break;
+        }
 
         // inc offset
         offset += inst->length;
+        previous = inst->flags;
 
         // invalid instruction, break.
         if (!inst->valid)
             break;
 
-        // is this a return instruction?
-        if (inst->instruction.type == RDA_INST_TY_CONTROL && \
-            strncmp(inst->instruction.mnemonic, "ret", 3) == 0)
+        // is this a return, or an unconditional jump?
+        if ((policy->stop & RDA_STOP_RET) && (inst->flags & RDA_INST_FL_RET))
+            break;
+        if ((policy->stop & RDA_STOP_JMP) && (inst->flags & RDA_INST_FL_TERM) && \
+            (inst->flags & RDA_INST_FL_BRANCH) && !(inst->flags & (RDA_INST_FL_COND | RDA_INST_FL_RET)))
             break;
     }
 
     // record total size of bytes consumed
-    function->bytes = calloc(1u, offset);
-    memcpy(function->bytes, bytes, offset);
+    function->length = offset;
     return function;
 };
 
+/**
+ * @brief free a disassembled function, its instructions and its snapshot (if any).
+ *
+ * @param function a function from rda_disassemble64(), rda_disassemble_arm64()
+ *  or rda_cache_load().
+ */
+void
+rda_free_function(rda_dec_fun_t* function) {
+    if (!function) return;
+    if (function->snapshot)
+        free(function->bytes);
+    rda_vec_free(&function->list);
+    free(function);
+};
+
 /**
  * @brief get the instruction at index within a function.
  *
@@ -346,5 +912,5 @@ rda_disassemble64(void* address) {
  */
 rda_dec_int_t*
 rda_get_instruction_at(rda_dec_fun_t* function, size_t index) {
-    return rda_dynl_get(function->list, index);
+    return rda_inst_vec_at(&function->list, index);
 };
\ No newline at end of file
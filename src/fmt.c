@@ -0,0 +1,397 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file fmt.c
+ */
+#include "fmt.h"
+
+/*! @uses strncmp */
+#include <string.h>
+
+/*! @uses rda_internal */
+#include "lib.h"
+
+/*! @uses rda_opnd_t, rda_get_operands, rda_get_register_name */
+#include "opnd.h"
+
+/// @note lowercase hexadecimal digits.
+static const char internal_hex_digits[16] = "0123456789abcdef";
+
+/// @note a bounded writer over a caller-provided buffer.
+typedef struct {
+    char* ptr;      // current write position.
+    char* end;      // last writable position (reserved for the null-terminator).
+    size_t count;   // number of characters that would have been written.
+} rda_writer_t;
+
+/**
+ * @brief write a single character.
+ */
+rda_internal void
+put_char(rda_writer_t* writer, char c) {
+    if (writer->ptr < writer->end)
+        *writer->ptr++ = c;
+    writer->count++;
+};
+
+/**
+ * @brief write a null-terminated string.
+ */
+rda_internal void
+put_str(rda_writer_t* writer, const char* str) {
+    while (*str)
+        put_char(writer, *str++);
+};
+
+/**
+ * @brief write <n> characters of <str>.
+ */
+rda_internal void
+put_strn(rda_writer_t* writer, const char* str, size_t n) {
+    for (size_t i = 0; i < n && str[i]; i++)
+        put_char(writer, str[i]);
+};
+
+/**
+ * @brief write <value> in hexadecimal (without a 0x prefix), the digit count
+ *  is derived from the highest set bit so there is no division or loop guessing.
+ */
+rda_internal void
+put_hex_raw(rda_writer_t* writer, unsigned long long value) {
+    int digits = value ? (67 - __builtin_clzll(value)) >> 2 : 1;
+    char text[16];
+    for (int i = digits - 1; i >= 0; i--) {
+        text[i] = internal_hex_digits[value & 0xf];
+        value >>= 4;
+    }
+    put_strn(writer, text, (size_t) digits);
+};
+
+/**
+ * @brief write <value> in hexadecimal with a 0x prefix.
+ */
+rda_internal void
+put_hex(rda_writer_t* writer, unsigned long long value) {
+    put_char(writer, '0');
+    put_char(writer, 'x');
+    put_hex_raw(writer, value);
+};
+
+/**
+ * @brief write a signed displacement as (-)0x...
+ */
+rda_internal void
+put_signed_hex(rda_writer_t* writer, long long value) {
+    if (value < 0) {
+        put_char(writer, '-');
+        put_hex(writer, 0ull - (unsigned long long) value);
+    } else put_hex(writer, (unsigned long long) value);
+};
+
+/**
+ * @brief mask <value> to <size> bits (sign-extended immediates are shown at operand width).
+ */
+rda_internal unsigned long long
+mask_to(long long value, unsigned short size) {
+    if (size == 0 || size >= 64) return (unsigned long long) value;
+    return (unsigned long long) value & ((1ull << size) - 1);
+};
+
+/**
+ * @brief get the at&t size suffix for a size in bits.
+ */
+rda_internal char
+att_suffix(unsigned short size) {
+    switch (size) {
+        case 8: return 'b';
+        case 16: return 'w';
+        case 32: return 'l';
+        case 64: return 'q';
+        default: return 0;
+    }
+};
+
+/**
+ * @brief get the intel "ptr" keyword for a memory operand of <size> bits.
+ */
+rda_internal const char*
+intel_ptr(unsigned short size) {
+    switch (size) {
+        case 8: return "byte ptr ";
+        case 16: return "word ptr ";
+        case 32: return "dword ptr ";
+        case 64: return "qword ptr ";
+        case 128: return "xmmword ptr ";
+        case 256: return "ymmword ptr ";
+        case 512: return "zmmword ptr ";
+        default: return "";
+    }
+};
+
+/**
+ * @brief write a register in the requested syntax.
+ */
+rda_internal void
+put_reg(rda_writer_t* writer, rda_reg_t reg, rda_syntax_t syntax) {
+    if (syntax == RDA_SYNTAX_ATT)
+        put_char(writer, '%');
+    put_str(writer, rda_get_register_name(reg));
+};
+
+/**
+ * @brief write a memory operand in intel syntax ([base+index*scale+disp]).
+ */
+rda_internal void
+put_mem_intel(rda_writer_t* writer, const rda_opnd_t* opnd, bool lea) {
+    if (!lea)
+        put_str(writer, intel_ptr(opnd->size));
+    if (opnd->segment.type != RDA_REG_TY_NONE) {
+        put_reg(writer, opnd->segment, RDA_SYNTAX_INTEL);
+        put_char(writer, ':');
+    }
+    put_char(writer, '[');
+    bool any = false;
+    if (opnd->base.type != RDA_REG_TY_NONE) {
+        put_reg(writer, opnd->base, RDA_SYNTAX_INTEL);
+        any = true;
+    }
+    if (opnd->index.type != RDA_REG_TY_NONE) {
+        if (any) put_char(writer, '+');
+        put_reg(writer, opnd->index, RDA_SYNTAX_INTEL);
+        put_char(writer, '*');
+        put_char(writer, (char) ('0' + opnd->scale));
+        any = true;
+    }
+    if (!any)
+        put_hex(writer, (unsigned long long) opnd->value);
+    else if (opnd->value != 0) {
+        if (opnd->value > 0) put_char(writer, '+');
+        put_signed_hex(writer, opnd->value);
+    }
+    put_char(writer, ']');
+};
+
+/**
+ * @brief write a memory operand in at&t syntax (disp(base,index,scale)).
+ */
+rda_internal void
+put_mem_att(rda_writer_t* writer, const rda_opnd_t* opnd) {
+    if (opnd->segment.type != RDA_REG_TY_NONE) {
+        put_reg(writer, opnd->segment, RDA_SYNTAX_ATT);
+        put_char(writer, ':');
+    }
+    bool regs = opnd->base.type != RDA_REG_TY_NONE || opnd->index.type != RDA_REG_TY_NONE;
+    if (!regs) {
+        put_hex(writer, (unsigned long long) opnd->value);
+        return;
+    }
+    if (opnd->value != 0)
+        put_signed_hex(writer, opnd->value);
+    put_char(writer, '(');
+    if (opnd->base.type != RDA_REG_TY_NONE)
+        put_reg(writer, opnd->base, RDA_SYNTAX_ATT);
+    if (opnd->index.type != RDA_REG_TY_NONE) {
+        put_char(writer, ',');
+        put_reg(writer, opnd->index, RDA_SYNTAX_ATT);
+        put_char(writer, ',');
+        put_char(writer, (char) ('0' + opnd->scale));
+    }
+    put_char(writer, ')');
+};
+
+/**
+ * @brief write a single operand in the requested syntax.
+ *
+ * @param writer the writer.
+ * @param opnd the operand.
+ * @param width the operation width used to display immediates.
+ * @param syntax the syntax to be used.
+ * @param lea if the instruction is an address computation (no ptr keyword).
+ * @param indirect if the operand is the target of an indirect call/jmp.
+ */
+rda_internal void
+put_operand(rda_writer_t* writer, const rda_opnd_t* opnd, unsigned short width,
+    rda_syntax_t syntax, bool lea, bool indirect) {
+    switch (opnd->type) {
+        case RDA_OPND_TY_REG:
+            if (indirect && syntax == RDA_SYNTAX_ATT) put_char(writer, '*');
+            put_reg(writer, opnd->reg, syntax);
+            break;
+        case RDA_OPND_TY_MEM:
+            if (syntax == RDA_SYNTAX_ATT) {
+                if (indirect) put_char(writer, '*');
+                put_mem_att(writer, opnd);
+            } else put_mem_intel(writer, opnd, lea);
+            break;
+        case RDA_OPND_TY_IMM:
+            if (syntax == RDA_SYNTAX_ATT) put_char(writer, '$');
+            put_hex(writer, mask_to(opnd->value, width));
+            break;
+        case RDA_OPND_TY_REL:
+            put_hex(writer, (unsigned long long) opnd->value);
+            break;
+        default:
+            break;
+    }
+};
+
+/**
+ * @brief format a single decoded instruction into a writer.
+ */
+rda_internal void
+format_into(rda_writer_t* writer, const rda_dec_int_t* inst, size_t address, rda_syntax_t syntax) {
+    if (!inst || !inst->valid || !inst->instruction->mnemonic) {
+        put_str(writer, "(bad)");
+        return;
+    }
+
+    // the instruction name is everything before the first space of the template.
+    const char* name = inst->instruction->mnemonic;
+    size_t name_length = 0;
+    while (name[name_length] && name[name_length] != ' ')
+        name_length++;
+
+    // decode the operands.
+    rda_opnd_t operands[RDA_OPND_MAX];
+    size_t count = rda_get_operands(inst, address, operands);
+
+    // 0x90 without rex.b is the one-byte nop, not xchg eax, eax.
+    const unsigned char opcode = inst->bytes[inst->prefix_count];
+    if (opcode == 0x90 && strncmp(name, "xchg", 4) == 0 && count == 2 && \
+        operands[1].reg.index == 0) {
+        name = "nop";
+        name_length = 3;
+        count = 0;
+    }
+
+    // lock and repeat prefixes.
+    bool string_op = count > 0 && operands[0].type == RDA_OPND_TY_MEM && !inst->instruction->modrm;
+    for (size_t i = 0; i < inst->prefix_count; i++) {
+        unsigned char byte = inst->bytes[i];
+        if (byte == 0xf0) put_str(writer, "lock ");
+        else if (byte == 0xf3 && string_op) put_str(writer, "rep ");
+        else if (byte == 0xf2 && string_op) put_str(writer, "repne ");
+    }
+
+    // classify the instruction for the syntax specific decorations.
+    bool lea = strncmp(name, "lea ", 4) == 0;
+    bool branch = (inst->flags & RDA_INST_FL_BRANCH) && !(inst->flags & (RDA_INST_FL_COND | RDA_INST_FL_RET));
+    unsigned short width = 0, mem_size = 0;
+    bool has_reg = false, has_mem = false;
+    for (size_t i = 0; i < count; i++) {
+        if (operands[i].type == RDA_OPND_TY_REG) has_reg = true;
+        if (operands[i].type == RDA_OPND_TY_MEM) {
+            has_mem = true;
+            mem_size = operands[i].size;
+        }
+        if (!width && operands[i].type != RDA_OPND_TY_IMM && operands[i].type != RDA_OPND_TY_REL)
+            width = operands[i].size;
+    }
+
+    // mnemonic.
+    if (syntax == RDA_SYNTAX_ATT && (strncmp(name, "movzx", 5) == 0 || strncmp(name, "movsx", 5) == 0) && count == 2) {
+        put_strn(writer, name, 4);
+        if (name_length == 6) put_char(writer, 'l'); // movsxd
+        else put_char(writer, att_suffix(operands[1].size) ? att_suffix(operands[1].size) : 'b');
+        put_char(writer, att_suffix(operands[0].size) ? att_suffix(operands[0].size) : 'l');
+    } else {
+        put_strn(writer, name, name_length);
+        char suffix = att_suffix(mem_size);
+        if (syntax == RDA_SYNTAX_ATT && has_mem && !has_reg && !branch && suffix && !string_op)
+            put_char(writer, suffix);
+    }
+    if (count == 0)
+        return;
+    put_char(writer, ' ');
+
+    // operands, reversed for at&t.
+    for (size_t i = 0; i < count; i++) {
+        size_t at = syntax == RDA_SYNTAX_ATT ? count - 1 - i : i;
+        if (i > 0) {
+            put_char(writer, ',');
+            if (syntax == RDA_SYNTAX_INTEL) put_char(writer, ' ');
+        }
+        put_operand(writer, &operands[at], width, syntax, lea, branch);
+    }
+
+    // resolved rip-relative reference.
+    for (size_t i = 0; i < count; i++) {
+        if (operands[i].type == RDA_OPND_TY_MEM && operands[i].base.type == RDA_REG_TY_RIP) {
+            put_str(writer, "  # ");
+            put_hex(writer, address + inst->length + (unsigned long long) operands[i].value);
+            break;
+        }
+    }
+};
+
+/**
+ * @brief begin writing into <buffer> of <size> bytes.
+ */
+rda_internal rda_writer_t
+writer_begin(char* buffer, size_t size) {
+    rda_writer_t writer = { buffer, buffer, 0 };
+    if (buffer && size > 0)
+        writer.end = buffer + size - 1;
+    return writer;
+};
+
+/**
+ * @brief null-terminate the output of a writer.
+ */
+rda_internal void
+writer_end(rda_writer_t* writer, char* buffer, size_t size) {
+    if (buffer && size > 0)
+        *writer->ptr = '\0';
+};
+
+/**
+ * @brief format a single decoded instruction into <buffer>, with real
+ *  registers, displacements, immediates and resolved branch targets.
+ *  this does not allocate and does not use printf; like snprintf the
+ *  output is truncated (but always null-terminated) if <size> is too small.
+ *
+ * @param inst a decoded instruction.
+ * @param address the runtime address of <inst> (used to resolve rel/rip targets).
+ * @param syntax the syntax to be used.
+ * @param buffer the buffer to be written to (may be 0x0 if <size> is 0).
+ * @param size the size of <buffer> in bytes.
+ * @return the length of the full text (excluding the null-terminator).
+ */
+size_t
+rda_format_instruction(const rda_dec_int_t* inst, size_t address, rda_syntax_t syntax,
+    char* buffer, size_t size) {
+    rda_writer_t writer = writer_begin(buffer, size);
+    format_into(&writer, inst, address, syntax);
+    writer_end(&writer, buffer, size);
+    return writer.count;
+};
+
+/**
+ * @brief format every instruction of a disassembled function into <buffer>,
+ *  one "<address>: <instruction>" line per instruction.
+ *
+ * @param function a disassembled function.
+ * @param syntax the syntax to be used.
+ * @param buffer the buffer to be written to (may be 0x0 if <size> is 0).
+ * @param size the size of <buffer> in bytes.
+ * @return the length of the full text (excluding the null-terminator); if this
+ *  is >= <size> the output was truncated.
+ */
+size_t
+rda_format_function(const rda_dec_fun_t* function, rda_syntax_t syntax, char* buffer, size_t size) {
+    rda_writer_t writer = writer_begin(buffer, size);
+    if (function) {
+        size_t address = function->address;
+        for (size_t i = 0; i < function->list.length; i++) {
+            const rda_dec_int_t* inst = rda_inst_vec_at(&function->list, i);
+            put_hex_raw(&writer, address);
+            put_str(&writer, ":\t");
+            format_into(&writer, inst, address, syntax);
+            put_char(&writer, '\n');
+            address += inst->length;
+        }
+    }
+    writer_end(&writer, buffer, size);
+    return writer.count;
+};
@@ -0,0 +1,288 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file fprint.c
+ */
+#include "fprint.h"
+
+/*! @uses calloc, free, qsort */
+#include <stdlib.h>
+
+/*! @uses memcpy, memmove, memset */
+#include <string.h>
+
+/*! @uses rda_internal */
+#include "lib.h"
+
+/*! @uses rda_get_operands, rda_opnd_t */
+#include "opnd.h"
+
+/// @note the number of sketch values hashed into one band.
+#define RDA_FPRINT_ROWS (RDA_FPRINT_HASHES / RDA_FPRINT_BANDS)
+
+/// @brief mix a 64-bit value (splitmix64 finalizer).
+rda_internal uint64_t
+fprint_mix(uint64_t value) {
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ull;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebull;
+    return value ^ (value >> 31);
+};
+
+/// @brief fold a value into a running hash.
+rda_internal uint64_t
+fprint_fold(uint64_t hash, uint64_t value) {
+    return fprint_mix(hash ^ (value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2)));
+};
+
+/**
+ * @brief get the normalized token of an instruction: its row, then the kind,
+ *  size and registers of each operand; displacements, immediates and branch
+ *  targets are left out, so they do not change between builds.
+ *
+ * @param inst the decoded instruction.
+ * @param address the runtime address of <inst>.
+ * @param memory pointer to where is written whether <inst> has a memory operand.
+ * @return the token.
+ */
+rda_internal uint64_t
+fprint_token(const rda_dec_int_t* inst, size_t address, bool* memory) {
+    rda_opnd_t operands[RDA_OPND_MAX];
+    size_t count = rda_get_operands(inst, address, operands);
+    uint64_t token = fprint_mix(inst->id + 1u);
+    *memory = false;
+    for (size_t i = 0; i < count; i++) {
+        const rda_opnd_t* operand = &operands[i];
+        uint64_t kind = (uint64_t) operand->type | (uint64_t) operand->size << 8;
+        if (operand->type == RDA_OPND_TY_REG)
+            kind |= (uint64_t) operand->reg.type << 24 | (uint64_t) operand->reg.index << 32;
+        else if (operand->type == RDA_OPND_TY_MEM) {
+            kind |= (uint64_t) operand->base.type << 24 | (uint64_t) operand->base.index << 32 | \
+                (uint64_t) operand->index.type << 40 | (uint64_t) operand->index.index << 48 | \
+                (uint64_t) operand->scale << 56 | (uint64_t) operand->segment.type << 60;
+            *memory = true;
+        }
+        token = fprint_fold(token, kind);
+    }
+    return token;
+};
+
+/**
+ * @brief lower the sketch of a fingerprint by the hashes of an n-gram.
+ *
+ * @param fprint the fingerprint.
+ * @param shingle the hash of the n-gram.
+ */
+rda_internal void
+fprint_shingle(rda_fprint_t* fprint, uint64_t shingle) {
+    for (size_t j = 0; j < RDA_FPRINT_HASHES; j++) {
+        uint32_t value = (uint32_t) fprint_mix(shingle ^ ((j + 1u) * 0x9e3779b97f4a7c15ull));
+        if (value < fprint->sketch[j]) fprint->sketch[j] = value;
+    }
+};
+
+/**
+ * @brief fingerprint a decoded amd64 function, up to its first invalid instruction.
+ *
+ * @param function the function.
+ * @param fprint the fingerprint to be written to.
+ * @return false if the function has no valid instruction.
+ */
+bool
+rda_fprint_compute(const rda_dec_fun_t* function, rda_fprint_t* fprint) {
+    if (!function || !fprint) return false;
+    *fprint = (rda_fprint_t) { .exact = 0xcbf29ce484222325ull };
+    memset(fprint->sketch, 0xff, sizeof fprint->sketch);
+
+    // the last RDA_FPRINT_NGRAM opcodes (row and whether it reads or writes memory).
+    uint64_t window[RDA_FPRINT_NGRAM] = { 0 };
+    for (size_t i = 0; i < function->list.length; i++) {
+        const rda_dec_int_t* inst = rda_inst_vec_at(&function->list, i);
+        if (!inst->valid) break;
+        size_t address = function->address + (size_t) (inst->bytes - function->bytes);
+        bool memory;
+        fprint->exact = fprint_fold(fprint->exact, fprint_token(inst, address, &memory));
+        memmove(window, window + 1, sizeof window - sizeof *window);
+        window[RDA_FPRINT_NGRAM - 1] = (uint64_t) inst->id << 1 | memory;
+        if (++fprint->instructions < RDA_FPRINT_NGRAM) continue;
+
+        uint64_t shingle = 0;
+        for (size_t j = 0; j < RDA_FPRINT_NGRAM; j++)
+            shingle = fprint_fold(shingle, window[j]);
+        fprint_shingle(fprint, shingle);
+    }
+    if (!fprint->instructions) return false;
+
+    // a function shorter than an n-gram is a single, shorter one.
+    if (fprint->instructions < RDA_FPRINT_NGRAM) {
+        uint64_t shingle = 0;
+        for (size_t j = RDA_FPRINT_NGRAM - fprint->instructions; j < RDA_FPRINT_NGRAM; j++)
+            shingle = fprint_fold(shingle, window[j]);
+        fprint_shingle(fprint, shingle);
+    }
+    fprint->exact = fprint_fold(fprint->exact, fprint->instructions);
+    return true;
+};
+
+/**
+ * @brief estimate the jaccard similarity of the n-grams of two fingerprints.
+ *
+ * @param a the first fingerprint.
+ * @param b the second fingerprint.
+ * @return the share of sketch values that are the same, in [0, 1].
+ */
+double
+rda_fprint_similarity(const rda_fprint_t* a, const rda_fprint_t* b) {
+    if (!a || !b) return 0.0;
+    size_t same = 0;
+    for (size_t j = 0; j < RDA_FPRINT_HASHES; j++)
+        same += a->sketch[j] == b->sketch[j];
+    return (double) same / RDA_FPRINT_HASHES;
+};
+
+/// @brief get the hash of a band of a sketch.
+rda_internal uint64_t
+fprint_band(const rda_fprint_t* fprint, size_t band) {
+    uint64_t hash = 0;
+    for (size_t j = band * RDA_FPRINT_ROWS; j < (band + 1u) * RDA_FPRINT_ROWS; j++)
+        hash = fprint_fold(hash, fprint->sketch[j]);
+    return hash;
+};
+
+/// @brief qsort comparator, keys by hash, then by index.
+rda_internal int
+compare_fprint_keys(const void* a, const void* b) {
+    const rda_fprint_key_t* x = a, * y = b;
+    if (x->key != y->key) return x->key < y->key ? -1 : 1;
+    return (x->index > y->index) - (x->index < y->index);
+};
+
+/**
+ * @brief build an index over fingerprints.
+ *
+ * @param fprints the fingerprints (copied).
+ * @param count the number of <fprints>.
+ * @return an allocated index or 0x0 on failure.
+ */
+rda_fprint_index_t*
+rda_fprint_index_create(const rda_fprint_t* fprints, size_t count) {
+    if ((!fprints && count) || count > UINT32_MAX) return 0x0;
+    rda_fprint_index_t* index = calloc(1u, sizeof *index);
+    if (index) {
+        index->count = count;
+        index->fprints = calloc(count ? count : 1u, sizeof *index->fprints);
+        index->exact = calloc(count ? count : 1u, sizeof *index->exact);
+        index->bands = calloc(count ? count * RDA_FPRINT_BANDS : 1u, sizeof *index->bands);
+    }
+    if (!index || !index->fprints || !index->exact || !index->bands) {
+        rda_fprint_index_destroy(index);
+        return 0x0;
+    }
+    if (count)
+        memcpy(index->fprints, fprints, count * sizeof *index->fprints);
+
+    // one sorted column for the exact hashes, and one per band.
+    for (size_t i = 0; i < count; i++) {
+        index->exact[i] = (rda_fprint_key_t) { .key = fprints[i].exact, .index = (uint32_t) i };
+        for (size_t band = 0; band < RDA_FPRINT_BANDS; band++)
+            index->bands[band * count + i] = (rda_fprint_key_t) { .key = fprint_band(&fprints[i], band),
+                .index = (uint32_t) i };
+    }
+    qsort(index->exact, count, sizeof *index->exact, compare_fprint_keys);
+    for (size_t band = 0; band < RDA_FPRINT_BANDS; band++)
+        qsort(index->bands + band * count, count, sizeof *index->bands, compare_fprint_keys);
+    return index;
+};
+
+/**
+ * @brief free an index of fingerprints.
+ *
+ * @param index the index to be freed.
+ */
+void
+rda_fprint_index_destroy(rda_fprint_index_t* index) {
+    if (!index) return;
+    free(index->fprints);
+    free(index->exact);
+    free(index->bands);
+    free(index);
+};
+
+/**
+ * @brief add the fingerprints of a bucket of a sorted column as candidates,
+ *  at most RDA_FPRINT_BUCKET_MAX of them.
+ *
+ * @param column the sorted column.
+ * @param count the number of keys in <column>.
+ * @param key the key of the bucket.
+ * @param candidates the candidates.
+ * @param found the number of <candidates>, to be added to.
+ */
+rda_internal void
+add_fprint_bucket(const rda_fprint_key_t* column, size_t count, uint64_t key, uint32_t* candidates, size_t* found) {
+    size_t low = 0, high = count;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (column[middle].key < key) low = middle + 1;
+        else high = middle;
+    }
+    for (size_t i = low; i < count && i - low < RDA_FPRINT_BUCKET_MAX && column[i].key == key; i++)
+        candidates[(*found)++] = column[i].index;
+};
+
+/// @brief qsort comparator, fingerprint indices in ascending order.
+rda_internal int
+compare_fprint_candidates(const void* a, const void* b) {
+    uint32_t x = *(const uint32_t*) a, y = *(const uint32_t*) b;
+    return (x > y) - (x < y);
+};
+
+/// @brief check whether a match ranks before another: exact first, then by similarity, then by index.
+rda_internal bool
+fprint_ranks_before(const rda_fprint_match_t* a, const rda_fprint_match_t* b) {
+    if (a->exact != b->exact) return a->exact;
+    if (a->similarity != b->similarity) return a->similarity > b->similarity;
+    return a->index < b->index;
+};
+
+/**
+ * @brief find the nearest fingerprints of an index: those with the same
+ *  exact hash, then those sharing a band of their sketch, by similarity.
+ *
+ * @param index the index.
+ * @param fprint the fingerprint to look up.
+ * @param matches the matches (<max_matches> of them) to be written to, the most similar first.
+ * @param max_matches the maximum number of matches.
+ * @return the number of matches written.
+ */
+size_t
+rda_fprint_index_query(const rda_fprint_index_t* index, const rda_fprint_t* fprint,
+    rda_fprint_match_t* matches, size_t max_matches) {
+    if (!index || !fprint || !matches || !max_matches) return 0;
+
+    // every bucket the fingerprint falls into, each fingerprint once.
+    uint32_t candidates[(RDA_FPRINT_BANDS + 1) * RDA_FPRINT_BUCKET_MAX];
+    size_t found = 0;
+    add_fprint_bucket(index->exact, index->count, fprint->exact, candidates, &found);
+    for (size_t band = 0; band < RDA_FPRINT_BANDS; band++)
+        add_fprint_bucket(index->bands + band * index->count, index->count, fprint_band(fprint, band),
+            candidates, &found);
+    qsort(candidates, found, sizeof *candidates, compare_fprint_candidates);
+
+    // keep the best <max_matches>, in rank order.
+    size_t written = 0;
+    for (size_t i = 0; i < found; i++) {
+        if (i && candidates[i] == candidates[i - 1]) continue;
+        const rda_fprint_t* other = &index->fprints[candidates[i]];
+        rda_fprint_match_t match = { .index = candidates[i], .exact = other->exact == fprint->exact };
+        match.similarity = match.exact ? 1.0 : rda_fprint_similarity(fprint, other);
+        if (written == max_matches && !fprint_ranks_before(&match, &matches[written - 1])) continue;
+        size_t at = written < max_matches ? written++ : written - 1;
+        for (; at && fprint_ranks_before(&match, &matches[at - 1]); at--)
+            matches[at] = matches[at - 1];
+        matches[at] = match;
+    }
+    return written;
+};
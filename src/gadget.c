@@ -0,0 +1,510 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file gadget.c
+ */
+#define _GNU_SOURCE
+#include "gadget.h"
+
+/*! @uses calloc, malloc, free, qsort */
+#include <stdlib.h>
+
+/*! @uses memcmp, memset */
+#include <string.h>
+
+/*! @uses uint32_t, uint64_t */
+#include <stdint.h>
+
+/*! @uses dl_iterate_phdr, ElfW */
+#include <link.h>
+
+/*! @uses sysconf, _SC_NPROCESSORS_ONLN */
+#include <unistd.h>
+
+/*! @uses thrd_t, thrd_create, thrd_join */
+#include <threads.h>
+
+/*! @uses atomic_size_t, atomic_fetch_add */
+#include <stdatomic.h>
+
+/*! @uses _mm256_*, _mm512_* */
+#include <immintrin.h>
+
+/*! @uses internal_prefix_table */
+#include "tables.h"
+
+/*! @uses rda_vec_t, RDA_VEC_TYPED */
+#include "vec.h"
+
+/*! @uses decode_into */
+#include "decode.h"
+
+/// @note the number of bytes of a segment a job looks for terminators in.
+#define RDA_GADGET_CHUNK 0x40000
+
+/// @note the bits of a decoded offset in the memo of a scan (0 is not decoded yet).
+#define RDA_GADGET_LENGTH 0x0f          // instruction length.
+#define RDA_GADGET_VALID 0x10           // a valid instruction.
+#define RDA_GADGET_FLOW 0x20            // transfers control, ends a gadget body.
+
+/// @note a part of an executable segment to look for terminators in.
+typedef struct {
+    const unsigned char* segment;   // the segment.
+    size_t size;                    // the size of <segment>.
+    size_t start, end;              // offsets of the part, [start, end).
+} rda_gadget_job_t;
+
+/// @note typed access to vectors of rda_gadget_t and rda_gadget_job_t.
+RDA_VEC_TYPED(gadget_vec, rda_gadget_t)
+RDA_VEC_TYPED(gadget_job_vec, rda_gadget_job_t)
+
+/// @note the jobs of an enumeration, shared by its workers.
+typedef struct {
+    const rda_gadget_job_t* jobs;   // the jobs.
+    size_t count;                   // number of <jobs>.
+    atomic_size_t next;             // the next job to be taken.
+    unsigned int kinds;             // rda_gadget_fl_t terminators.
+    size_t max_bytes, max_instructions; // the budgets (0 instructions for none).
+} rda_gadget_work_t;
+
+/// @note a worker of an enumeration and the gadgets it found.
+typedef struct {
+    rda_gadget_work_t* work;        // the shared jobs.
+    rda_vec_t found;                // rda_gadget_t.
+    unsigned char* memo;            // the memo of the current job.
+    bool failed;                    // if an allocation failed.
+} rda_gadget_worker_t;
+
+/// @note the state of a job.
+typedef struct {
+    const rda_gadget_work_t* work;  // the budgets.
+    const unsigned char* bytes;     // the segment.
+    size_t size;                    // the size of <bytes>.
+    size_t base;                    // the offset of memo[0].
+    unsigned char* memo;            // one decoded offset per byte, see RDA_GADGET_LENGTH.
+    rda_vec_t* found;               // rda_gadget_t.
+    bool failed;                    // if an allocation failed.
+} rda_gadget_scan_t;
+
+/**
+ * @brief decode an offset of a segment once, and remember its length and
+ *  whether it can be part of a gadget body.
+ *
+ * @param scan the job.
+ * @param offset the offset in the segment (within the memo).
+ * @return the bits of RDA_GADGET_LENGTH/VALID/FLOW.
+ */
+rda_internal unsigned char
+decode_offset(rda_gadget_scan_t* scan, size_t offset) {
+    unsigned char* slot = &scan->memo[offset - scan->base];
+    if (*slot) return *slot;
+
+    rda_dec_int_t inst;
+    memset(&inst, 0, sizeof inst);
+    size_t available = scan->size - offset < 15 ? scan->size - offset : 15;
+    decode_into(scan->bytes + offset, available, &inst);
+    if (!inst.valid || inst.length == 0 || inst.length > 15) {
+        *slot = 1; // not valid, length 1.
+        return *slot;
+    }
+    *slot = (unsigned char) (inst.length | RDA_GADGET_VALID);
+    if (inst.flags & (RDA_INST_FL_BRANCH | RDA_INST_FL_TERM))
+        *slot |= RDA_GADGET_FLOW;
+    return *slot;
+};
+
+/**
+ * @brief record a gadget.
+ */
+rda_internal void
+add_gadget(rda_gadget_scan_t* scan, size_t offset, size_t length, size_t count, unsigned int kind) {
+    rda_gadget_t gadget = {
+        .address = (size_t) (scan->bytes + offset), .length = (unsigned short) length,
+        .count = (unsigned char) count, .kind = (unsigned char) kind, .instances = 1,
+    };
+    if (!gadget_vec_push(scan->found, &gadget))
+        scan->failed = true;
+};
+
+/**
+ * @brief collect the gadgets ending with the terminator at an offset, by
+ *  chaining the instructions decoded at every offset before it back to it.
+ *
+ * @param scan the job.
+ * @param start the offset of the terminator.
+ * @param end the offset past the terminator.
+ * @param kind the rda_gadget_fl_t of the terminator.
+ */
+rda_internal void
+collect_gadgets(rda_gadget_scan_t* scan, size_t start, size_t end, unsigned int kind) {
+    size_t max_bytes = scan->work->max_bytes, max_instructions = scan->work->max_instructions;
+    if (end - start > max_bytes) return;
+    add_gadget(scan, start, end - start, 1, kind);
+
+    // steps[d], the number of instructions from start - d to the end (0 if
+    //  the decode from start - d does not land on the terminator).
+    unsigned char steps[RDA_GADGET_BYTES_MAX + 1] = { 1 };
+    for (size_t d = 1; d <= start - scan->base && end - start + d <= max_bytes; d++) {
+        size_t offset = start - d;
+        unsigned char decoded = decode_offset(scan, offset);
+        size_t next = offset + (decoded & RDA_GADGET_LENGTH);
+        if (!(decoded & RDA_GADGET_VALID) || (decoded & RDA_GADGET_FLOW) || next > start || !steps[start - next])
+            continue;
+        steps[d] = (unsigned char) (steps[start - next] + 1);
+        if (!max_instructions || steps[d] <= max_instructions)
+            add_gadget(scan, offset, end - offset, steps[d], kind);
+    }
+};
+
+/**
+ * @brief check a terminator byte candidate, and collect the gadgets of every
+ *  terminator it is the opcode of (with and without the prefixes before it).
+ *
+ * @param scan the job.
+ * @param offset the offset of the candidate byte.
+ */
+rda_internal void
+check_candidate(rda_gadget_scan_t* scan, size_t offset) {
+    unsigned char opcode = scan->bytes[offset];
+    unsigned int kind = 0;
+    if (opcode == 0xc3 || opcode == 0xc2)
+        kind = RDA_GADGET_RET;
+    else if (opcode == 0xff && offset + 1 < scan->size) {
+        unsigned char reg = (scan->bytes[offset + 1] >> 3) & 7;
+        kind = reg == 2 ? RDA_GADGET_CALL : reg == 4 ? RDA_GADGET_JMP : 0;
+    }
+    if (!(kind & scan->work->kinds)) return;
+
+    unsigned char decoded = decode_offset(scan, offset);
+    if (!(decoded & RDA_GADGET_VALID)) return;
+    size_t end = offset + (decoded & RDA_GADGET_LENGTH);
+    collect_gadgets(scan, offset, end, kind);
+
+    // the same terminator with the prefix bytes before it.
+    for (size_t start = offset; start > scan->base && offset - start < 4; ) {
+        if (!internal_prefix_table[scan->bytes[--start]]) break;
+        decoded = decode_offset(scan, start);
+        if ((decoded & RDA_GADGET_VALID) && start + (decoded & RDA_GADGET_LENGTH) == end)
+            collect_gadgets(scan, start, end, kind);
+    }
+};
+
+/**
+ * @brief find terminator byte candidates in 64-byte blocks with avx-512 byte compares.
+ *
+ * @param scan the job.
+ * @param position the offset to start at.
+ * @param end the offset to stop before.
+ * @return the offset where the vector loop stopped.
+ */
+__attribute__((target("avx512f,avx512bw")))
+rda_internal size_t
+find_terminators_avx512(rda_gadget_scan_t* scan, size_t position, size_t end) {
+    bool ret = scan->work->kinds & RDA_GADGET_RET, indirect = scan->work->kinds & (RDA_GADGET_JMP | RDA_GADGET_CALL);
+    for (; position + 64 <= end; position += 64) {
+        __m512i block = _mm512_loadu_si512((const void*) (scan->bytes + position));
+        uint64_t candidates = 0;
+        if (ret) // c2 and c3 differ only in bit 0.
+            candidates |= _mm512_cmpeq_epi8_mask(_mm512_or_si512(block, _mm512_set1_epi8(1)), _mm512_set1_epi8((char) 0xc3));
+        if (indirect)
+            candidates |= _mm512_cmpeq_epi8_mask(block, _mm512_set1_epi8((char) 0xff));
+        for (; candidates; candidates &= candidates - 1)
+            check_candidate(scan, position + __builtin_ctzll(candidates));
+    }
+    return position;
+};
+
+/**
+ * @brief find terminator byte candidates in 32-byte blocks with avx2 byte compares.
+ *
+ * @param scan the job.
+ * @param position the offset to start at.
+ * @param end the offset to stop before.
+ * @return the offset where the vector loop stopped.
+ */
+__attribute__((target("avx2")))
+rda_internal size_t
+find_terminators_avx2(rda_gadget_scan_t* scan, size_t position, size_t end) {
+    bool ret = scan->work->kinds & RDA_GADGET_RET, indirect = scan->work->kinds & (RDA_GADGET_JMP | RDA_GADGET_CALL);
+    for (; position + 32 <= end; position += 32) {
+        __m256i block = _mm256_loadu_si256((const __m256i*) (scan->bytes + position));
+        uint32_t candidates = 0;
+        if (ret)
+            candidates |= (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(
+                _mm256_or_si256(block, _mm256_set1_epi8(1)), _mm256_set1_epi8((char) 0xc3)));
+        if (indirect)
+            candidates |= (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(block, _mm256_set1_epi8((char) 0xff)));
+        for (; candidates; candidates &= candidates - 1)
+            check_candidate(scan, position + __builtin_ctz(candidates));
+    }
+    return position;
+};
+
+/**
+ * @brief run a job, collecting the gadgets whose terminator is in it.
+ *
+ * @param work the budgets.
+ * @param job the job.
+ * @param memo a zeroed memo of at least RDA_GADGET_CHUNK + max_bytes + 15 bytes.
+ * @param found the vector gadgets are added to.
+ * @return false if an allocation failed.
+ */
+rda_internal bool
+run_job(const rda_gadget_work_t* work, const rda_gadget_job_t* job, unsigned char* memo, rda_vec_t* found) {
+    rda_gadget_scan_t scan = {
+        .work = work, .bytes = job->segment, .size = job->size,
+        .base = job->start > work->max_bytes ? job->start - work->max_bytes : 0,
+        .memo = memo, .found = found,
+    };
+
+    // vector loop over whole blocks, picked by what the cpu supports.
+    size_t position = job->start;
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512bw"))
+        position = find_terminators_avx512(&scan, position, job->end);
+    else if (__builtin_cpu_supports("avx2"))
+        position = find_terminators_avx2(&scan, position, job->end);
+
+    // scalar loop for the tail (or everything without avx2).
+    for (; position < job->end; position++) {
+        unsigned char byte = job->segment[position];
+        if ((byte | 1) == 0xc3 || byte == 0xff)
+            check_candidate(&scan, position);
+    }
+    return !scan.failed;
+};
+
+/**
+ * @brief worker thread, run jobs until there are none left.
+ */
+rda_internal int
+gadget_worker(void* data) {
+    rda_gadget_worker_t* worker = data;
+    rda_gadget_work_t* work = worker->work;
+    size_t memo_size = RDA_GADGET_CHUNK + work->max_bytes + 16;
+    worker->memo = malloc(memo_size);
+    if (!worker->memo) {
+        worker->failed = true;
+        return 0;
+    }
+    for (size_t i; (i = atomic_fetch_add(&work->next, 1)) < work->count; ) {
+        memset(worker->memo, 0, memo_size);
+        if (!run_job(work, &work->jobs[i], worker->memo, &worker->found))
+            worker->failed = true;
+    }
+    free(worker->memo);
+    return 0;
+};
+
+/**
+ * @brief order gadgets by their bytes, then by address.
+ */
+rda_internal int
+compare_gadget_bytes(const void* a, const void* b) {
+    const rda_gadget_t* x = a, * y = b;
+    if (x->length != y->length) return x->length < y->length ? -1 : 1;
+    int order = memcmp((const void*) x->address, (const void*) y->address, x->length);
+    if (order) return order;
+    return (x->address > y->address) - (x->address < y->address);
+};
+
+/**
+ * @brief order gadgets by address, then by length.
+ */
+rda_internal int
+compare_gadget_address(const void* a, const void* b) {
+    const rda_gadget_t* x = a, * y = b;
+    if (x->address != y->address) return x->address < y->address ? -1 : 1;
+    return (x->length > y->length) - (x->length < y->length);
+};
+
+/**
+ * @brief fill in the defaults of a policy.
+ */
+rda_internal void
+init_work(rda_gadget_work_t* work, const rda_gadget_policy_t* policy) {
+    work->kinds = policy && policy->kinds ? policy->kinds & RDA_GADGET_ALL : RDA_GADGET_ALL;
+    work->max_bytes = policy && policy->max_bytes ? policy->max_bytes : RDA_GADGET_BYTES;
+    if (work->max_bytes > RDA_GADGET_BYTES_MAX) work->max_bytes = RDA_GADGET_BYTES_MAX;
+    work->max_instructions = policy ? policy->max_instructions : 0;
+};
+
+/**
+ * @brief split a segment into jobs.
+ */
+rda_internal void
+add_jobs(rda_vec_t* jobs, const unsigned char* segment, size_t size) {
+    for (size_t start = 0; start < size; start += RDA_GADGET_CHUNK) {
+        rda_gadget_job_t job = {
+            .segment = segment, .size = size, .start = start,
+            .end = size - start < RDA_GADGET_CHUNK ? size : start + RDA_GADGET_CHUNK,
+        };
+        gadget_job_vec_push(jobs, &job);
+    }
+};
+
+/**
+ * @brief run the jobs of an enumeration on worker threads and deduplicate
+ *  what they found into a set.
+ *
+ * @param work the jobs and budgets.
+ * @param workers the number of worker threads (the calling thread is one).
+ * @return an allocated set or 0x0 on failure.
+ */
+rda_internal rda_gadget_set_t*
+run_work(rda_gadget_work_t* work, size_t workers) {
+    if (workers > work->count) workers = work->count;
+    if (workers < 1) workers = 1;
+    rda_gadget_worker_t* pool = calloc(workers, sizeof *pool);
+    thrd_t* threads = calloc(workers, sizeof *threads);
+    rda_gadget_set_t* set = calloc(1u, sizeof *set);
+    if (!pool || !threads || !set) {
+        free(pool);
+        free(threads);
+        free(set);
+        return 0x0;
+    }
+
+    // the calling thread is worker 0, the others run on their own threads.
+    size_t started = 1;
+    for (size_t i = 0; i < workers; i++) {
+        pool[i].work = work;
+        gadget_vec_init(&pool[i].found, 0x0);
+    }
+    for (; started < workers; started++)
+        if (thrd_create(&threads[started], gadget_worker, &pool[started]) != thrd_success)
+            break;
+    gadget_worker(&pool[0]);
+    bool failed = pool[0].failed;
+    for (size_t i = 1; i < started; i++) {
+        thrd_join(threads[i], 0x0);
+        failed |= pool[i].failed;
+    }
+
+    // gather everything into one array.
+    size_t total = 0;
+    for (size_t i = 0; i < workers; i++)
+        total += pool[i].found.length;
+    set->gadgets = failed ? 0x0 : malloc((total ? total : 1) * sizeof *set->gadgets);
+    if (set->gadgets) {
+        for (size_t i = 0; i < workers; i++) {
+            memcpy(set->gadgets + set->count, gadget_vec_data(&pool[i].found), pool[i].found.length * sizeof *set->gadgets);
+            set->count += pool[i].found.length;
+        }
+    }
+    for (size_t i = 0; i < workers; i++)
+        rda_vec_free(&pool[i].found);
+    free(pool);
+    free(threads);
+    if (!set->gadgets) {
+        free(set);
+        return 0x0;
+    }
+
+    // deduplicate by bytes, keeping the lowest address of each, then order by address.
+    qsort(set->gadgets, set->count, sizeof *set->gadgets, compare_gadget_bytes);
+    size_t unique = 0;
+    for (size_t i = 0; i < set->count; i++) {
+        rda_gadget_t* last = unique ? &set->gadgets[unique - 1] : 0x0;
+        if (last && last->length == set->gadgets[i].length && \
+            memcmp((const void*) last->address, (const void*) set->gadgets[i].address, last->length) == 0) {
+            last->instances++;
+            continue;
+        }
+        set->gadgets[unique++] = set->gadgets[i];
+    }
+    set->count = unique;
+    qsort(set->gadgets, set->count, sizeof *set->gadgets, compare_gadget_address);
+    return set;
+};
+
+/**
+ * @brief dl_iterate_phdr callback, split every executable segment into jobs.
+ */
+rda_internal int
+collect_gadget_segments(struct dl_phdr_info* info, size_t size, void* data) {
+    (void) size;
+    for (size_t i = 0; i < info->dlpi_phnum; i++) {
+        const ElfW(Phdr)* phdr = &info->dlpi_phdr[i];
+        if (phdr->p_type != PT_LOAD || !(phdr->p_flags & PF_X) || !phdr->p_memsz)
+            continue;
+        add_jobs(data, (const unsigned char*) (info->dlpi_addr + phdr->p_vaddr), phdr->p_memsz);
+    }
+    return 0;
+};
+
+/**
+ * @brief enumerate the gadgets in every executable segment of every loaded
+ *  module; the segments are split into chunks that are scanned in parallel.
+ *
+ * @param policy what to collect, 0x0 for the defaults.
+ * @return an allocated set or 0x0 on failure.
+ */
+rda_gadget_set_t*
+rda_gadgets_create(const rda_gadget_policy_t* policy) {
+    rda_vec_t jobs;
+    gadget_job_vec_init(&jobs, 0x0);
+    dl_iterate_phdr(collect_gadget_segments, &jobs);
+
+    rda_gadget_work_t work = { .jobs = gadget_job_vec_data(&jobs), .count = jobs.length };
+    init_work(&work, policy);
+    size_t workers = policy && policy->workers ? policy->workers : 0;
+    if (!workers) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        workers = online > 0 ? (size_t) online : 1;
+    }
+    if (workers > RDA_GADGET_WORKERS_MAX) workers = RDA_GADGET_WORKERS_MAX;
+
+    rda_gadget_set_t* set = run_work(&work, workers);
+    rda_vec_free(&jobs);
+    return set;
+};
+
+/**
+ * @brief enumerate the gadgets in a region of memory, on the calling thread.
+ *
+ * @param bytes the start of the region.
+ * @param size the size of the region in bytes.
+ * @param policy what to collect, 0x0 for the defaults (workers are ignored).
+ * @return an allocated set or 0x0 on failure.
+ */
+rda_gadget_set_t*
+rda_gadgets_scan(const unsigned char* bytes, size_t size, const rda_gadget_policy_t* policy) {
+    if (!bytes) return 0x0;
+    rda_vec_t jobs;
+    gadget_job_vec_init(&jobs, 0x0);
+    add_jobs(&jobs, bytes, size);
+
+    rda_gadget_work_t work = { .jobs = gadget_job_vec_data(&jobs), .count = jobs.length };
+    init_work(&work, policy);
+    rda_gadget_set_t* set = run_work(&work, 1);
+    rda_vec_free(&jobs);
+    return set;
+};
+
+/**
+ * @brief free a set of gadgets.
+ *
+ * @param set the set to be freed.
+ */
+void
+rda_gadgets_destroy(rda_gadget_set_t* set) {
+    if (!set) return;
+    free(set->gadgets);
+    free(set);
+};
+
+/**
+ * @brief disassemble a gadget.
+ *
+ * @param gadget the gadget.
+ * @return a pointer to an allocated structure containing the information
+ *  about the instructions of the gadget in amd64.
+ */
+rda_dec_fun_t*
+rda_disassemble_gadget(const rda_gadget_t* gadget) {
+    if (!gadget) return 0x0;
+    rda_range_policy_t policy = { .max_instructions = gadget->count };
+    return rda_disassemble_range64((void*) gadget->address, gadget->length, &policy);
+};
@@ -0,0 +1,540 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file integrity.c
+ */
+#define _GNU_SOURCE
+#include "integrity.h"
+
+/*! @uses calloc, free, qsort */
+#include <stdlib.h>
+
+/*! @uses memcpy, memcmp, memset */
+#include <string.h>
+
+/*! @uses uint32_t, uint64_t, SIZE_MAX */
+#include <stdint.h>
+
+/*! @uses dl_iterate_phdr, ElfW */
+#include <link.h>
+
+/*! @uses open, O_RDONLY */
+#include <fcntl.h>
+
+/*! @uses mmap, munmap */
+#include <sys/mman.h>
+
+/*! @uses fstat */
+#include <sys/stat.h>
+
+/*! @uses close */
+#include <unistd.h>
+
+/*! @uses _mm256_*, _mm512_* */
+#include <immintrin.h>
+
+/*! @uses rda_internal */
+#include "lib.h"
+
+/*! @uses rda_vec_t, RDA_VEC_TYPED */
+#include "vec.h"
+
+/*! @uses decode_into */
+#include "decode.h"
+
+/// @note the maximum number of executable segments of a module we compare.
+#define RDA_INTEGRITY_SEGMENTS 8
+
+/// @note how far before a difference we look for the start of its function.
+#define RDA_INTEGRITY_REACH 0x100000
+
+/// @note a loaded module and its executable segments.
+typedef struct {
+    const char* name;               // dlpi_name, empty for the main program.
+    size_t base;                    // load bias.
+    size_t vaddr[RDA_INTEGRITY_SEGMENTS], size[RDA_INTEGRITY_SEGMENTS]; // executable segments (file size).
+    size_t count;                   // number of segments.
+} rda_module_t;
+
+/// @note typed access to a vector of rda_module_t.
+RDA_VEC_TYPED(module_vec, rda_module_t)
+
+/// @note a function symbol of a module file.
+typedef struct {
+    size_t address, size;           // virtual address and size (0 if unknown).
+    const char* name;               // the name (in the mapped file), 0x0 if unknown.
+    size_t parent;                  // the nearest earlier function containing this one's start, SIZE_MAX if none.
+} rda_image_function_t;
+
+/// @note a private, writable mapping of a module file.
+typedef struct {
+    unsigned char* image;           // the file contents.
+    size_t size;                    // the file size.
+    const char* path;               // the file path.
+    rda_image_function_t* functions; // ordered by address, read on the first difference (see index_functions()).
+    size_t function_count;          // number of <functions>.
+    bool indexed;                   // if <functions> was read.
+} rda_image_t;
+
+/// @note the state of a scan.
+typedef struct {
+    rda_patch_callback_t callback;  // the user callback.
+    void* data;                     // user data for <callback>.
+    size_t patches;                 // number of modified instructions reported.
+    bool stopped;                   // if the callback asked to stop.
+} rda_integrity_scan_t;
+
+/**
+ * @brief dl_iterate_phdr callback, collect every module and its executable segments.
+ */
+rda_internal int
+collect_modules(struct dl_phdr_info* info, size_t size, void* data) {
+    (void) size;
+    rda_module_t module = { .name = info->dlpi_name ? info->dlpi_name : "", .base = info->dlpi_addr };
+    for (size_t i = 0; i < info->dlpi_phnum && module.count < RDA_INTEGRITY_SEGMENTS; i++) {
+        const ElfW(Phdr)* phdr = &info->dlpi_phdr[i];
+        if (phdr->p_type != PT_LOAD || !(phdr->p_flags & PF_X))
+            continue;
+        module.vaddr[module.count] = phdr->p_vaddr;
+        module.size[module.count++] = phdr->p_filesz;
+    }
+    if (module.count)
+        module_vec_push(data, &module);
+    return 0;
+};
+
+/**
+ * @brief map a module file privately, so relocations can be applied to it.
+ *
+ * @param module the module.
+ * @param image the mapping to be written to.
+ * @return false if the module has no readable 64-bit ELF file.
+ */
+rda_internal bool
+map_image(const rda_module_t* module, rda_image_t* image) {
+    *image = (rda_image_t) { .path = module->name[0] ? module->name : "/proc/self/exe" };
+    int fd = open(image->path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(ElfW(Ehdr))) {
+        close(fd);
+        return false;
+    }
+    image->size = (size_t) st.st_size;
+    image->image = mmap(0x0, image->size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (image->image == MAP_FAILED) return false;
+
+    const ElfW(Ehdr)* ehdr = (const ElfW(Ehdr)*) image->image;
+    if (memcmp(ehdr->e_ident, ELFMAG, SELFMAG) != 0 || ehdr->e_ident[EI_CLASS] != ELFCLASS64 || \
+        ehdr->e_machine != EM_X86_64 || ehdr->e_phoff + (size_t) ehdr->e_phnum * sizeof(ElfW(Phdr)) > image->size) {
+        munmap(image->image, image->size);
+        return false;
+    }
+    return true;
+};
+
+/**
+ * @brief get the program headers of a mapped file.
+ */
+rda_internal const ElfW(Phdr)*
+get_phdrs(const rda_image_t* image, size_t* count) {
+    const ElfW(Ehdr)* ehdr = (const ElfW(Ehdr)*) image->image;
+    *count = ehdr->e_phnum;
+    return (const ElfW(Phdr)*) (image->image + ehdr->e_phoff);
+};
+
+/**
+ * @brief translate a virtual address of a mapped file into a pointer into it.
+ *
+ * @param image the mapped file.
+ * @param vaddr the virtual address.
+ * @param width the number of bytes that must be present.
+ * @return the pointer or 0x0 if the address is not backed by the file.
+ */
+rda_internal unsigned char*
+at_vaddr(const rda_image_t* image, size_t vaddr, size_t width) {
+    size_t count;
+    const ElfW(Phdr)* phdrs = get_phdrs(image, &count);
+    for (size_t i = 0; i < count; i++) {
+        const ElfW(Phdr)* phdr = &phdrs[i];
+        if (phdr->p_type != PT_LOAD || vaddr < phdr->p_vaddr || vaddr + width > phdr->p_vaddr + phdr->p_filesz)
+            continue;
+        size_t offset = phdr->p_offset + (vaddr - phdr->p_vaddr);
+        return offset + width <= image->size ? image->image + offset : 0x0;
+    }
+    return 0x0;
+};
+
+/**
+ * @brief check whether a relocation target lies within an executable segment.
+ */
+rda_internal bool
+in_segments(const rda_module_t* module, size_t vaddr, size_t width) {
+    for (size_t i = 0; i < module->count; i++)
+        if (vaddr >= module->vaddr[i] && vaddr + width <= module->vaddr[i] + module->size[i])
+            return true;
+    return false;
+};
+
+/**
+ * @brief relocate a word of the file image that lies within an executable segment;
+ *  relative relocations are recomputed, symbol relocations are taken from memory.
+ *
+ * @param module the module.
+ * @param image the mapped file.
+ * @param vaddr the address of the word.
+ * @param width the size of the word.
+ * @param relative if the word is base-relative.
+ * @param addend the addend of a relative relocation.
+ */
+rda_internal void
+relocate(const rda_module_t* module, const rda_image_t* image, size_t vaddr, size_t width, bool relative, size_t addend) {
+    if (!in_segments(module, vaddr, width)) return;
+    unsigned char* where = at_vaddr(image, vaddr, width);
+    if (!where) return;
+    if (relative) {
+        uint64_t value = module->base + addend;
+        memcpy(where, &value, sizeof value);
+    }
+    else memcpy(where, (const void*) (module->base + vaddr), width);
+};
+
+/**
+ * @brief apply the dynamic relocations (rela and relr) of a module that land in
+ *  its executable segments (text relocations) to the file image.
+ *
+ * @param module the module.
+ * @param image the mapped file.
+ */
+rda_internal void
+apply_relocations(const rda_module_t* module, const rda_image_t* image) {
+    size_t count;
+    const ElfW(Phdr)* phdrs = get_phdrs(image, &count);
+    const ElfW(Dyn)* dynamic = 0x0;
+    size_t dynamic_count = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (phdrs[i].p_type == PT_DYNAMIC && phdrs[i].p_offset + phdrs[i].p_filesz <= image->size) {
+            dynamic = (const ElfW(Dyn)*) (image->image + phdrs[i].p_offset);
+            dynamic_count = phdrs[i].p_filesz / sizeof *dynamic;
+        }
+    }
+    if (!dynamic) return;
+
+    size_t rela = 0, rela_size = 0, relr = 0, relr_size = 0;
+    for (size_t i = 0; i < dynamic_count && dynamic[i].d_tag != DT_NULL; i++) {
+        switch (dynamic[i].d_tag) {
+            case DT_RELA: rela = dynamic[i].d_un.d_ptr; break;
+            case DT_RELASZ: rela_size = dynamic[i].d_un.d_val; break;
+            case DT_RELR: relr = dynamic[i].d_un.d_ptr; break;
+            case DT_RELRSZ: relr_size = dynamic[i].d_un.d_val; break;
+            default: break;
+        }
+    }
+
+    const ElfW(Rela)* relas = rela_size ? (const ElfW(Rela)*) at_vaddr(image, rela, rela_size) : 0x0;
+    for (size_t i = 0; relas && i < rela_size / sizeof *relas; i++) {
+        unsigned int type = ELF64_R_TYPE(relas[i].r_info);
+        if (type == R_X86_64_NONE) continue;
+        bool narrow = type == R_X86_64_PC32 || type == R_X86_64_32 || type == R_X86_64_32S || type == R_X86_64_PLT32;
+        relocate(module, image, relas[i].r_offset, narrow ? 4u : 8u, type == R_X86_64_RELATIVE, relas[i].r_addend);
+    }
+
+    // relr: an address, then bitmaps of the 63 words that follow it.
+    const ElfW(Relr)* relrs = relr_size ? (const ElfW(Relr)*) at_vaddr(image, relr, relr_size) : 0x0;
+    size_t next = 0;
+    for (size_t i = 0; relrs && i < relr_size / sizeof *relrs; i++) {
+        if (!(relrs[i] & 1)) {
+            const unsigned char* where = at_vaddr(image, relrs[i], 8u);
+            uint64_t addend = 0;
+            if (where) memcpy(&addend, where, sizeof addend);
+            relocate(module, image, relrs[i], 8u, true, addend);
+            next = relrs[i] + 8u;
+            continue;
+        }
+        for (size_t bit = 1; bit < 64; bit++) {
+            if (!((relrs[i] >> bit) & 1)) continue;
+            size_t vaddr = next + (bit - 1) * 8u;
+            const unsigned char* where = at_vaddr(image, vaddr, 8u);
+            uint64_t addend = 0;
+            if (where) memcpy(&addend, where, sizeof addend);
+            relocate(module, image, vaddr, 8u, true, addend);
+        }
+        next += 63u * 8u;
+    }
+};
+
+/**
+ * @brief skip 64-byte blocks that are equal, with avx-512 compares.
+ *
+ * @return the offset of the first block that differs (or of the tail).
+ */
+__attribute__((target("avx512f,avx512bw")))
+rda_internal size_t
+skip_equal_avx512(const unsigned char* a, const unsigned char* b, size_t size, size_t position) {
+    for (; position + 64 <= size; position += 64) {
+        __m512i x = _mm512_loadu_si512((const void*) (a + position));
+        __m512i y = _mm512_loadu_si512((const void*) (b + position));
+        if (_mm512_cmpneq_epi8_mask(x, y))
+            break;
+    }
+    return position;
+};
+
+/**
+ * @brief skip 32-byte blocks that are equal, with avx2 compares.
+ *
+ * @return the offset of the first block that differs (or of the tail).
+ */
+__attribute__((target("avx2")))
+rda_internal size_t
+skip_equal_avx2(const unsigned char* a, const unsigned char* b, size_t size, size_t position) {
+    for (; position + 32 <= size; position += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*) (a + position));
+        __m256i y = _mm256_loadu_si256((const __m256i*) (b + position));
+        if ((uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)) != 0xffffffffu)
+            break;
+    }
+    return position;
+};
+
+/**
+ * @brief find the first differing byte at or after <position>.
+ *
+ * @return its offset, or <size> if the rest is equal.
+ */
+rda_internal size_t
+find_difference(const unsigned char* a, const unsigned char* b, size_t size, size_t position) {
+    if (__builtin_cpu_supports("avx512bw"))
+        position = skip_equal_avx512(a, b, size, position);
+    else if (__builtin_cpu_supports("avx2"))
+        position = skip_equal_avx2(a, b, size, position);
+    while (position < size && a[position] == b[position])
+        position++;
+    return position;
+};
+
+/// @brief qsort comparator, functions by address, then the larger one first.
+rda_internal int
+compare_image_functions(const void* a, const void* b) {
+    const rda_image_function_t* x = a, * y = b;
+    if (x->address != y->address) return x->address < y->address ? -1 : 1;
+    return (x->size < y->size) - (x->size > y->size);
+};
+
+/// @brief check whether a function of a mapped file contains an address; an unsized one only its start.
+rda_internal bool
+image_function_contains(const rda_image_function_t* function, size_t vaddr) {
+    return vaddr >= function->address && vaddr < function->address + (function->size ? function->size : 1u);
+};
+
+/**
+ * @brief read the function symbols of a mapped file (.symtab if present,
+ *  .dynsym otherwise) into an array ordered by address, once per file.
+ *
+ * @param image the mapped file.
+ */
+rda_internal void
+index_functions(rda_image_t* image) {
+    if (image->indexed) return;
+    image->indexed = true;
+    const ElfW(Ehdr)* ehdr = (const ElfW(Ehdr)*) image->image;
+    if (!ehdr->e_shoff || ehdr->e_shentsize != sizeof(ElfW(Shdr)) || \
+        ehdr->e_shoff + (size_t) ehdr->e_shnum * sizeof(ElfW(Shdr)) > image->size)
+        return;
+    const ElfW(Shdr)* shdrs = (const ElfW(Shdr)*) (image->image + ehdr->e_shoff);
+    const ElfW(Shdr)* table = 0x0;
+    for (size_t i = 0; i < ehdr->e_shnum; i++) {
+        if (shdrs[i].sh_type == SHT_SYMTAB || (shdrs[i].sh_type == SHT_DYNSYM && !table))
+            table = &shdrs[i];
+    }
+    if (!table || table->sh_link >= ehdr->e_shnum || table->sh_offset + table->sh_size > image->size)
+        return;
+    const ElfW(Shdr)* strings = &shdrs[table->sh_link];
+    if (strings->sh_offset + strings->sh_size > image->size)
+        return;
+
+    const ElfW(Sym)* symbols = (const ElfW(Sym)*) (image->image + table->sh_offset);
+    size_t count = table->sh_size / sizeof *symbols;
+    image->functions = calloc(count ? count : 1u, sizeof *image->functions);
+    if (!image->functions) return;
+    for (size_t i = 0; i < count; i++) {
+        const ElfW(Sym)* symbol = &symbols[i];
+        unsigned char type = ELF64_ST_TYPE(symbol->st_info);
+        if ((type != STT_FUNC && type != STT_GNU_IFUNC) || symbol->st_shndx == SHN_UNDEF)
+            continue;
+        image->functions[image->function_count++] = (rda_image_function_t) {
+            .address = symbol->st_value, .size = symbol->st_size,
+            .name = symbol->st_name < strings->sh_size ? \
+                (const char*) image->image + strings->sh_offset + symbol->st_name : 0x0,
+        };
+    }
+    qsort(image->functions, image->function_count, sizeof *image->functions, compare_image_functions);
+
+    // every function containing an address contains the start of the last one before it.
+    for (size_t i = 0; i < image->function_count; i++) {
+        size_t parent = i - 1;
+        while (parent != SIZE_MAX && !image_function_contains(&image->functions[parent], image->functions[i].address))
+            parent = image->functions[parent].parent;
+        image->functions[i].parent = parent;
+    }
+};
+
+/**
+ * @brief find the function containing a virtual address of a mapped file, the
+ *  one starting closest to it if several do.
+ *
+ * @param image the mapped file (see index_functions()).
+ * @param vaddr the virtual address.
+ * @param name pointer to where the symbol name is written.
+ * @return the address of the function, or 0 if none was found.
+ */
+rda_internal size_t
+find_function(const rda_image_t* image, size_t vaddr, const char** name) {
+    *name = 0x0;
+    size_t low = 0, high = image->function_count;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (image->functions[middle].address <= vaddr) low = middle + 1;
+        else high = middle;
+    }
+    size_t found = low - 1;
+    while (found != SIZE_MAX && !image_function_contains(&image->functions[found], vaddr))
+        found = image->functions[found].parent;
+    if (found == SIZE_MAX) return 0;
+    *name = image->functions[found].name;
+    return image->functions[found].address;
+};
+
+/**
+ * @brief decode the instructions overlapping a differing range and report them.
+ *
+ * @param scan the scan state.
+ * @param module the module.
+ * @param image the mapped (relocated) file.
+ * @param segment the index of the executable segment.
+ * @param start the offset of the range within the segment.
+ * @param end the end offset of the range.
+ * @param position where the previous range stopped decoding (an instruction boundary).
+ * @return the offset decoding stopped at (past the range).
+ */
+rda_internal size_t
+report_range(rda_integrity_scan_t* scan, const rda_module_t* module, rda_image_t* image,
+    size_t segment, size_t start, size_t end, size_t position) {
+    const unsigned char* live = (const unsigned char*) (module->base + module->vaddr[segment]);
+    const unsigned char* file = at_vaddr(image, module->vaddr[segment], module->size[segment]);
+    size_t size = module->size[segment];
+
+    // boundaries come from the original code, the function start if we know it.
+    const char* symbol;
+    index_functions(image);
+    size_t function = find_function(image, module->vaddr[segment] + start, &symbol);
+    size_t from = start;
+    if (function && function >= module->vaddr[segment] && module->vaddr[segment] + start - function < RDA_INTEGRITY_REACH)
+        from = function - module->vaddr[segment];
+    if (position < from) position = from;
+
+    // only the original is decoded up to the range, in place; the live code only where it differs.
+    rda_patch_t patch = {
+        .module = image->path,
+        .function = function ? module->base + function : 0,
+        .symbol = symbol,
+    };
+    while (position < end && !scan->stopped) {
+        size_t available = size - position < 15 ? size - position : 15;
+        memset(&patch.original, 0, sizeof patch.original);
+        decode_into(file + position, available, &patch.original);
+        size_t length = patch.original.length ? patch.original.length : 1u;
+        if (position + length > start) {
+            memset(&patch.live, 0, sizeof patch.live);
+            decode_into(live + position, available, &patch.live);
+            patch.address = (size_t) live + position;
+            scan->patches++;
+            if (scan->callback && !scan->callback(&patch, scan->data))
+                scan->stopped = true;
+        }
+        position += length;
+    }
+    return position;
+};
+
+/**
+ * @brief compare the executable segments of a module against its file.
+ *
+ * @param scan the scan state.
+ * @param module the module.
+ */
+rda_internal void
+scan_module(rda_integrity_scan_t* scan, const rda_module_t* module) {
+    rda_image_t image;
+    if (!map_image(module, &image)) return;
+    apply_relocations(module, &image);
+
+    for (size_t i = 0; i < module->count && !scan->stopped; i++) {
+        const unsigned char* live = (const unsigned char*) (module->base + module->vaddr[i]);
+        const unsigned char* file = at_vaddr(&image, module->vaddr[i], module->size[i]);
+        if (!file) continue;
+
+        // one compare pass, decoding only where the bytes differ.
+        size_t size = module->size[i], position = 0, decoded = 0;
+        while (!scan->stopped && (position = find_difference(live, file, size, position)) < size) {
+            size_t last = position;
+            for (size_t j = position + 1; j < size && j - last <= RDA_INTEGRITY_GAP; j++)
+                if (live[j] != file[j]) last = j;
+            decoded = report_range(scan, module, &image, i, position, last + 1, decoded);
+            position = decoded > last + 1 ? decoded : last + 1;
+        }
+    }
+    munmap(image.image, image.size);
+    free(image.functions);
+};
+
+/**
+ * @brief compare the executable segments of the loaded module containing
+ *  <module> against its file (with relocations applied), and decode only the
+ *  ranges that differ. relocations that depend on symbols are not verified.
+ *
+ * @param module any address within the module.
+ * @param callback the callback for every modified instruction.
+ * @param data user data passed to <callback>.
+ * @return the number of modified instructions reported.
+ */
+size_t
+rda_integrity_scan_module(const void* module, rda_patch_callback_t callback, void* data) {
+    rda_vec_t modules;
+    module_vec_init(&modules, 0x0);
+    dl_iterate_phdr(collect_modules, &modules);
+
+    // the module whose executable segments hold the address.
+    rda_integrity_scan_t scan = { .callback = callback, .data = data };
+    for (size_t i = 0; i < modules.length; i++) {
+        const rda_module_t* candidate = module_vec_at(&modules, i);
+        if (in_segments(candidate, (size_t) module - candidate->base, 1u)) {
+            scan_module(&scan, candidate);
+            break;
+        }
+    }
+    rda_vec_free(&modules);
+    return scan.patches;
+};
+
+/**
+ * @brief rda_integrity_scan_module() over every loaded module that has a file.
+ *
+ * @param callback the callback for every modified instruction.
+ * @param data user data passed to <callback>.
+ * @return the number of modified instructions reported.
+ */
+size_t
+rda_integrity_scan(rda_patch_callback_t callback, void* data) {
+    rda_vec_t modules;
+    module_vec_init(&modules, 0x0);
+    dl_iterate_phdr(collect_modules, &modules);
+
+    rda_integrity_scan_t scan = { .callback = callback, .data = data };
+    for (size_t i = 0; i < modules.length && !scan.stopped; i++)
+        scan_module(&scan, module_vec_at(&modules, i));
+    rda_vec_free(&modules);
+    return scan.patches;
+};
@@ -0,0 +1,223 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file ipmap.c
+ */
+#include "ipmap.h"
+
+/*! @uses calloc, free, qsort */
+#include <stdlib.h>
+
+/*! @uses rda_internal */
+#include "lib.h"
+
+/// @note a function before it is split into columns.
+typedef struct {
+    rda_dec_fun_t* function;
+    unsigned int origin;
+} rda_ipmap_entry_t;
+
+/// @brief order entries by start address.
+rda_internal int
+compare_starts(const void* a, const void* b) {
+    const rda_ipmap_entry_t* x = a, *y = b;
+    if (x->function->address != y->function->address)
+        return x->function->address < y->function->address ? -1 : 1;
+    return (x->origin > y->origin) - (x->origin < y->origin);
+};
+
+/**
+ * @brief build a reverse index over decoded amd64 functions.
+ *
+ * @param functions decoded functions (non-overlapping).
+ * @param count the number of <functions>.
+ * @return an allocated index or 0x0 on failure.
+ */
+rda_ipmap_t*
+rda_ipmap_create(rda_dec_fun_t** functions, size_t count) {
+    if (!functions) return 0x0;
+
+    // order the functions by start address.
+    rda_ipmap_entry_t* entries = calloc(count ? count : 1u, sizeof *entries);
+    if (!entries) return 0x0;
+    size_t n = 0, total_words = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (!functions[i] || !functions[i]->length) continue;
+        entries[n++] = (rda_ipmap_entry_t) { functions[i], (unsigned int) i };
+        total_words += (functions[i]->length + 63) / 64;
+    }
+    qsort(entries, n, sizeof *entries, compare_starts);
+
+    // allocate the columns.
+    rda_ipmap_t* map = calloc(1u, sizeof *map);
+    size_t m = n ? n : 1u, w = total_words ? total_words : 1u;
+    if (map) {
+        map->count = n;
+        map->start = calloc(m, sizeof *map->start);
+        map->end = calloc(m, sizeof *map->end);
+        map->functions = calloc(m, sizeof *map->functions);
+        map->origin = calloc(m, sizeof *map->origin);
+        map->words = calloc(m, sizeof *map->words);
+        map->bits = calloc(w, sizeof *map->bits);
+        map->ranks = calloc(w, sizeof *map->ranks);
+    }
+    if (!map || !map->start || !map->end || !map->functions || !map->origin || \
+        !map->words || !map->bits || !map->ranks) {
+        free(entries);
+        rda_ipmap_destroy(map);
+        return 0x0;
+    }
+
+    // mark where every instruction starts, then count the marks before every word.
+    size_t word = 0;
+    for (size_t i = 0; i < n; i++) {
+        rda_dec_fun_t* function = entries[i].function;
+        map->start[i] = function->address;
+        map->end[i] = function->address + function->length;
+        map->functions[i] = function;
+        map->origin[i] = entries[i].origin;
+        map->words[i] = word;
+
+        uint64_t* bits = map->bits + word;
+        for (size_t j = 0; j < function->list.length; j++) {
+            size_t offset = (size_t) (rda_get_instruction_at(function, j)->bytes - function->bytes);
+            if (offset < function->length)
+                bits[offset / 64] |= 1ull << (offset % 64);
+        }
+        size_t words = (function->length + 63) / 64;
+        uint32_t rank = 0;
+        for (size_t k = 0; k < words; k++) {
+            map->ranks[word + k] = rank;
+            rank += (uint32_t) __builtin_popcountll(bits[k]);
+        }
+        word += words;
+    }
+    free(entries);
+    return map;
+};
+
+/**
+ * @brief free a reverse index (not the functions it refers to).
+ *
+ * @param map the index to be freed.
+ */
+void
+rda_ipmap_destroy(rda_ipmap_t* map) {
+    if (!map) return;
+    free(map->start);
+    free(map->end);
+    free(map->functions);
+    free(map->origin);
+    free(map->words);
+    free(map->bits);
+    free(map->ranks);
+    free(map);
+};
+
+/**
+ * @brief resolve an address within an entry through its boundary bitmap.
+ *
+ * @param map the index.
+ * @param entry the entry whose start is the last one at or below <ip>.
+ * @param ip the instruction pointer.
+ * @param hit the result to be written to.
+ * @return true if <ip> lies within the function.
+ */
+rda_internal bool
+resolve_in(const rda_ipmap_t* map, size_t entry, size_t ip, rda_ip_hit_t* hit) {
+    *hit = (rda_ip_hit_t) { .type = RDA_INST_TY_INVALID };
+    if (ip >= map->end[entry]) return false;
+
+    // find the last boundary at or before the offset, scanning back a word at a time.
+    size_t offset = ip - map->start[entry];
+    const uint64_t* bits = map->bits + map->words[entry];
+    const uint32_t* ranks = map->ranks + map->words[entry];
+    size_t k = offset / 64;
+    uint64_t word = bits[k] & (~0ull >> (63 - offset % 64));
+    while (!word && k) word = bits[--k];
+    if (!word) return false;
+
+    // the rank of that boundary is the index of the instruction.
+    size_t top = 63 - (size_t) __builtin_clzll(word);
+    size_t index = ranks[k] + (size_t) __builtin_popcountll(word) - 1;
+    rda_dec_int_t* inst = rda_get_instruction_at(map->functions[entry], index);
+    if (!inst) return false;
+    hit->inst = inst;
+    hit->function = map->origin[entry];
+    hit->instruction = index;
+    hit->address = map->start[entry] + k * 64 + top;
+    hit->type = rda_get_type(inst);
+    return true;
+};
+
+/**
+ * @brief resolve a single instruction pointer with a binary search; an
+ *  address inside an instruction resolves to that instruction.
+ *
+ * @param map the index.
+ * @param ip the instruction pointer.
+ * @param hit the result to be written to.
+ * @return true if <ip> lies within an indexed function.
+ */
+bool
+rda_ipmap_lookup(const rda_ipmap_t* map, size_t ip, rda_ip_hit_t* hit) {
+    rda_ip_hit_t ignored;
+    if (!hit) hit = &ignored;
+    *hit = (rda_ip_hit_t) { .type = RDA_INST_TY_INVALID };
+    if (!map) return false;
+
+    // the last function starting at or below <ip>.
+    size_t low = 0, high = map->count;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (map->start[middle] <= ip) low = middle + 1;
+        else high = middle;
+    }
+    return low && resolve_in(map, low - 1, ip, hit);
+};
+
+/**
+ * @brief resolve a batch of unsorted instruction pointers, one search each.
+ *
+ * @param map the index.
+ * @param ips the instruction pointers.
+ * @param count the number of <ips>.
+ * @param hits the results (<count> of them) to be written to.
+ * @return the number of resolved instruction pointers.
+ */
+size_t
+rda_ipmap_resolve(const rda_ipmap_t* map, const size_t* ips, size_t count, rda_ip_hit_t* hits) {
+    if (!ips || !hits) return 0;
+    size_t resolved = 0;
+    for (size_t i = 0; i < count; i++)
+        resolved += rda_ipmap_lookup(map, ips[i], &hits[i]);
+    return resolved;
+};
+
+/**
+ * @brief resolve a batch of instruction pointers sorted in ascending order,
+ *  walking the functions alongside the samples instead of searching.
+ *
+ * @param map the index.
+ * @param ips the instruction pointers (sorted).
+ * @param count the number of <ips>.
+ * @param hits the results (<count> of them) to be written to.
+ * @return the number of resolved instruction pointers.
+ */
+size_t
+rda_ipmap_resolve_sorted(const rda_ipmap_t* map, const size_t* ips, size_t count, rda_ip_hit_t* hits) {
+    if (!map || !ips || !hits) return 0;
+    size_t resolved = 0, entry = 0;
+    for (size_t i = 0; i < count; i++) {
+        // move to the last function starting at or below this sample.
+        while (entry < map->count && map->start[entry] <= ips[i])
+            entry++;
+        if (!entry) {
+            hits[i] = (rda_ip_hit_t) { .type = RDA_INST_TY_INVALID };
+            continue;
+        }
+        resolved += resolve_in(map, entry - 1, ips[i], &hits[i]);
+    }
+    return resolved;
+};
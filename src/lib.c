@@ -6,6 +6,9 @@
  */
 #include "lib.h"
 
+/*! @uses rda_memmap_expire */
+#include "memmap.h"
+
 /// @note static context for librda.
 rda_context_t g_ctx;
 
@@ -18,8 +21,12 @@ rda_context_t g_ctx;
  */
 void
 rda_begin(rda_context_t ctx) {
-    // set our global context.
+    // set our global context, and pick the decoder for its profiles once.
     g_ctx = ctx;
+    rda_select_decoder(ctx);
+
+    // and let the map of the address space catch up with what was mapped since.
+    rda_memmap_expire();
 };
 
 /**
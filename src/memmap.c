@@ -0,0 +1,326 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file memmap.c
+ */
+#define _GNU_SOURCE
+#include "memmap.h"
+
+/*! @uses calloc, free */
+#include <stdlib.h>
+
+/*! @uses memcpy */
+#include <string.h>
+
+/*! @uses FILE, fopen, fscanf, fclose */
+#include <stdio.h>
+
+/*! @uses bool, true, false */
+#include <stdbool.h>
+
+/*! @uses dl_iterate_phdr, dl_phdr_info */
+#include <link.h>
+
+/*! @uses call_once, once_flag, mtx_t, mtx_init, mtx_lock, mtx_unlock */
+#include <threads.h>
+
+/*! @uses atomic_load_explicit, atomic_store_explicit, atomic_exchange, atomic_fetch_add_explicit */
+#include <stdatomic.h>
+
+/*! @uses rda_internal */
+#include "lib.h"
+
+/*! @uses RDA_PAGE_SIZE */
+#include "disas.h"
+
+/*! @uses rda_vec_t, RDA_VEC_TYPED */
+#include "vec.h"
+
+/// @note typed access to a vector of rda_mapping_t.
+RDA_VEC_TYPED(mapping_vec, rda_mapping_t)
+
+/**
+ * @brief read the mappings of the address space from /proc/self/maps.
+ *
+ * @return an allocated map or 0x0 on failure.
+ */
+rda_memmap_t*
+rda_memmap_create(void) {
+    FILE* file = fopen("/proc/self/maps", "r");
+    if (!file) return 0x0;
+
+    // every line is "start-end rights offset device inode [path]", ordered by address.
+    rda_vec_t mappings;
+    mapping_vec_init(&mappings, 0x0);
+    size_t start, end;
+    char rights[5];
+    bool complete = true;
+    while (fscanf(file, "%zx-%zx %4s%*[^\n]", &start, &end, rights) == 3) {
+        rda_mapping_t mapping = { .start = start, .end = end, .reach = start };
+        mapping.rights = (rights[0] == 'r' ? RDA_MAP_READ : 0) | \
+            (rights[1] == 'w' ? RDA_MAP_WRITE : 0) | (rights[2] == 'x' ? RDA_MAP_EXEC : 0);
+        if (!mapping_vec_push(&mappings, &mapping)) {
+            complete = false; // out of memory
+            break;
+        }
+    }
+    fclose(file);
+
+    rda_memmap_t* map = complete ? calloc(1u, sizeof *map) : 0x0;
+    if (map) {
+        map->count = mappings.length;
+        map->mappings = calloc(map->count ? map->count : 1u, sizeof *map->mappings);
+    }
+    if (!map || !map->mappings) {
+        rda_memmap_destroy(map);
+        map = 0x0;
+    }
+    else if (map->count) {
+        memcpy(map->mappings, mapping_vec_data(&mappings), map->count * sizeof *map->mappings);
+
+        // a readable mapping reaches as far as the readable mappings right after it.
+        for (size_t i = map->count; i-- > 0;) {
+            rda_mapping_t* mapping = &map->mappings[i];
+            if (!(mapping->rights & RDA_MAP_READ)) continue;
+            mapping->reach = mapping->end;
+            if (i + 1 < map->count && map->mappings[i + 1].start == mapping->end && \
+                (map->mappings[i + 1].rights & RDA_MAP_READ))
+                mapping->reach = map->mappings[i + 1].reach;
+        }
+    }
+    rda_vec_free(&mappings);
+    return map;
+};
+
+/**
+ * @brief free a map of the address space.
+ *
+ * @param map the map to be freed.
+ */
+void
+rda_memmap_destroy(rda_memmap_t* map) {
+    if (!map) return;
+    free(map->mappings);
+    free(map);
+};
+
+/// @note a process-wide map and the module counters it was read at.
+typedef struct rda_memmap_node {
+    rda_memmap_t* map;
+    unsigned long long adds, subs;  // dlpi_adds and dlpi_subs when <map> was read.
+    atomic_uint generation;         // <g_memmap_generation> when <map> was last read.
+    struct rda_memmap_node* next;   // the node this one replaced.
+} rda_memmap_node_t;
+
+/// @note the process-wide map, see rda_get_memmap(); replaced under <g_memmap_lock>.
+static _Atomic(rda_memmap_node_t*) g_memmap;
+static mtx_t g_memmap_lock;
+static once_flag g_memmap_once = ONCE_FLAG_INIT;
+
+/// @note advanced by rda_memmap_expire(), a miss reads the map again at most once per generation.
+static atomic_uint g_memmap_generation;
+
+/// @brief initialize the lock replacing the process-wide map.
+rda_internal void
+init_memmap_lock(void) {
+    mtx_init(&g_memmap_lock, mtx_plain);
+};
+
+/// @brief free the process-wide map and every map it replaced.
+__attribute__((destructor)) static void
+free_memmaps(void) {
+    rda_memmap_node_t* node = atomic_exchange(&g_memmap, 0x0);
+    while (node) {
+        rda_memmap_node_t* next = node->next;
+        rda_memmap_destroy(node->map);
+        free(node);
+        node = next;
+    }
+};
+
+/**
+ * @brief dl_iterate_phdr callback, read the module load and unload counters.
+ *
+ * @param info the first module.
+ * @param size the size of <info>.
+ * @param data the rda_memmap_node_t the counters are written to.
+ * @return 1, the counters are the same for every module.
+ */
+rda_internal int
+read_module_counters(struct dl_phdr_info* info, size_t size, void* data) {
+    rda_memmap_node_t* counters = data;
+    if (size >= offsetof(struct dl_phdr_info, dlpi_subs) + sizeof info->dlpi_subs) {
+        counters->adds = info->dlpi_adds;
+        counters->subs = info->dlpi_subs;
+    }
+    return 1;
+};
+
+/**
+ * @brief check whether two maps list the same mappings.
+ *
+ * @param a the first map.
+ * @param b the second map.
+ * @return true if they are the same.
+ */
+rda_internal bool
+same_mappings(const rda_memmap_t* a, const rda_memmap_t* b) {
+    if (a->count != b->count) return false;
+    for (size_t i = 0; i < a->count; i++) {
+        const rda_mapping_t* x = &a->mappings[i], * y = &b->mappings[i];
+        if (x->start != y->start || x->end != y->end || x->rights != y->rights)
+            return false;
+    }
+    return true;
+};
+
+/**
+ * @brief read the process-wide map again, unless another thread replaced
+ *  <seen> meanwhile; a map read at the same counters as <seen> and listing the
+ *  same mappings is dropped so that repeated misses do not pile up maps.
+ *
+ * @param seen the current node when the caller decided to refresh.
+ * @param counters the module counters to record.
+ * @return the current node, 0x0 if no map could be read yet.
+ */
+rda_internal rda_memmap_node_t*
+refresh_memmap(rda_memmap_node_t* seen, const rda_memmap_node_t* counters) {
+    call_once(&g_memmap_once, init_memmap_lock);
+    mtx_lock(&g_memmap_lock);
+    rda_memmap_node_t* current = atomic_load_explicit(&g_memmap, memory_order_acquire);
+    if (current == seen) {
+        unsigned generation = atomic_load_explicit(&g_memmap_generation, memory_order_relaxed);
+        rda_memmap_t* map = rda_memmap_create();
+        rda_memmap_node_t* node = map ? calloc(1u, sizeof *node) : 0x0;
+        if (node && (!seen || seen->adds != counters->adds || seen->subs != counters->subs || \
+            !same_mappings(seen->map, map))) {
+            node->map = map;
+            node->adds = counters->adds;
+            node->subs = counters->subs;
+            atomic_init(&node->generation, generation);
+            node->next = seen;
+            atomic_store_explicit(&g_memmap, node, memory_order_release);
+            current = node;
+        }
+        else {
+            // <seen> is as recent as the map just read.
+            if (seen && map) atomic_store_explicit(&seen->generation, generation, memory_order_relaxed);
+            rda_memmap_destroy(map);
+            free(node);
+        }
+    }
+    mtx_unlock(&g_memmap_lock);
+    return current;
+};
+
+/**
+ * @brief get the process-wide node, read again if a module was loaded or
+ *  unloaded since it was read.
+ *
+ * @return the node or 0x0 on failure.
+ */
+rda_internal rda_memmap_node_t*
+get_memmap_node(void) {
+    rda_memmap_node_t counters = { 0 };
+    dl_iterate_phdr(read_module_counters, &counters);
+    rda_memmap_node_t* node = atomic_load_explicit(&g_memmap, memory_order_acquire);
+    if (!node || node->adds != counters.adds || node->subs != counters.subs)
+        node = refresh_memmap(node, &counters);
+    return node;
+};
+
+/**
+ * @brief read the process-wide map again if a module was loaded or unloaded
+ *  since it was read (a compare of the dl_iterate_phdr counters); called once
+ *  per disassembled function, so that no read trusts the mappings of a module
+ *  that was unloaded.
+ */
+void
+rda_memmap_check(void) {
+    if (atomic_load_explicit(&g_memmap, memory_order_acquire))
+        get_memmap_node();
+};
+
+/**
+ * @brief start a new generation of the process-wide map, called by
+ *  rda_begin(): the map is read again if a module was loaded or unloaded, and
+ *  the next miss of rda_memmap_readable() may read it again.
+ */
+void
+rda_memmap_expire(void) {
+    atomic_fetch_add_explicit(&g_memmap_generation, 1u, memory_order_relaxed);
+    rda_memmap_check();
+};
+
+/**
+ * @brief get the process-wide map of the address space, read on first use and
+ *  again whenever a module was loaded or unloaded since (dl_iterate_phdr); maps
+ *  that were replaced stay valid until exit.
+ *
+ * @return the map or 0x0 on failure.
+ */
+const rda_memmap_t*
+rda_get_memmap(void) {
+    rda_memmap_node_t* node = get_memmap_node();
+    return node ? node->map : 0x0;
+};
+
+/**
+ * @brief find the mapping containing an address.
+ *
+ * @param map the map.
+ * @param address the address.
+ * @return the mapping or 0x0.
+ */
+const rda_mapping_t*
+rda_memmap_lookup(const rda_memmap_t* map, size_t address) {
+    if (!map) return 0x0;
+
+    // the last mapping starting at or before the address.
+    size_t low = 0, high = map->count;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (map->mappings[middle].start <= address) low = middle + 1;
+        else high = middle;
+    }
+    if (!low) return 0x0;
+    const rda_mapping_t* mapping = &map->mappings[low - 1];
+    return address < mapping->end ? mapping : 0x0;
+};
+
+/**
+ * @brief clamp a read to the readable memory at an address; a read within one
+ *  page is returned as is, others are checked against the process-wide map as
+ *  of the last rda_memmap_check(). if <address> is not readable in it, the map
+ *  is read again when a module was loaded or unloaded, or once per generation
+ *  (see rda_memmap_expire()) for memory mapped since.
+ *
+ * @param address the start of the read.
+ * @param size the number of bytes to be read.
+ * @return how many of the <size> bytes can be read without faulting, <size>
+ *  if /proc/self/maps cannot be read.
+ */
+size_t
+rda_memmap_readable(const void* address, size_t size) {
+    // a read within one page only touches the page of its first byte.
+    size_t start = (size_t) address;
+    if (size <= RDA_PAGE_SIZE - (start & (RDA_PAGE_SIZE - 1)))
+        return size;
+
+    rda_memmap_node_t* node = atomic_load_explicit(&g_memmap, memory_order_acquire);
+    if (!node && !(node = get_memmap_node())) return size;
+    const rda_mapping_t* mapping = rda_memmap_lookup(node->map, start);
+    if (!mapping || !(mapping->rights & RDA_MAP_READ)) {
+        // only a miss checks the module counters, and reads /proc/self/maps once per generation.
+        rda_memmap_node_t* current = get_memmap_node();
+        if (current == node && atomic_load_explicit(&node->generation, memory_order_relaxed) != \
+            atomic_load_explicit(&g_memmap_generation, memory_order_relaxed))
+            current = refresh_memmap(node, node);
+        if (current && current != node)
+            mapping = rda_memmap_lookup(current->map, start);
+        if (!mapping || !(mapping->rights & RDA_MAP_READ)) return 0;
+    }
+    size_t readable = mapping->reach - start;
+    return size < readable ? size : readable;
+};
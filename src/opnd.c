@@ -0,0 +1,547 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file opnd.c
+ */
+#include "opnd.h"
+
+/*! @uses strchr, strlen, strncmp, memchr, memset */
+#include <string.h>
+
+/*! @uses rda_internal */
+#include "lib.h"
+
+/// @note register names for each register class, indexed by register number.
+static const char* internal_gpr64_names[16] = {
+    "rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi",
+    "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15"
+};
+static const char* internal_gpr32_names[16] = {
+    "eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi",
+    "r8d", "r9d", "r10d", "r11d", "r12d", "r13d", "r14d", "r15d"
+};
+static const char* internal_gpr16_names[16] = {
+    "ax", "cx", "dx", "bx", "sp", "bp", "si", "di",
+    "r8w", "r9w", "r10w", "r11w", "r12w", "r13w", "r14w", "r15w"
+};
+static const char* internal_gpr8_names[16] = {
+    "al", "cl", "dl", "bl", "spl", "bpl", "sil", "dil",
+    "r8b", "r9b", "r10b", "r11b", "r12b", "r13b", "r14b", "r15b"
+};
+static const char* internal_gpr8h_names[4] = { "ah", "ch", "dh", "bh" };
+static const char* internal_seg_names[6] = { "es", "cs", "ss", "ds", "fs", "gs" };
+static const char* internal_vec_names[3][32] = {
+    { "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7",
+      "xmm8", "xmm9", "xmm10", "xmm11", "xmm12", "xmm13", "xmm14", "xmm15",
+      "xmm16", "xmm17", "xmm18", "xmm19", "xmm20", "xmm21", "xmm22", "xmm23",
+      "xmm24", "xmm25", "xmm26", "xmm27", "xmm28", "xmm29", "xmm30", "xmm31" },
+    { "ymm0", "ymm1", "ymm2", "ymm3", "ymm4", "ymm5", "ymm6", "ymm7",
+      "ymm8", "ymm9", "ymm10", "ymm11", "ymm12", "ymm13", "ymm14", "ymm15",
+      "ymm16", "ymm17", "ymm18", "ymm19", "ymm20", "ymm21", "ymm22", "ymm23",
+      "ymm24", "ymm25", "ymm26", "ymm27", "ymm28", "ymm29", "ymm30", "ymm31" },
+    { "zmm0", "zmm1", "zmm2", "zmm3", "zmm4", "zmm5", "zmm6", "zmm7",
+      "zmm8", "zmm9", "zmm10", "zmm11", "zmm12", "zmm13", "zmm14", "zmm15",
+      "zmm16", "zmm17", "zmm18", "zmm19", "zmm20", "zmm21", "zmm22", "zmm23",
+      "zmm24", "zmm25", "zmm26", "zmm27", "zmm28", "zmm29", "zmm30", "zmm31" },
+};
+static const char* internal_mmx_names[8] = {
+    "mm0", "mm1", "mm2", "mm3", "mm4", "mm5", "mm6", "mm7"
+};
+static const char* internal_mask_names[8] = {
+    "k0", "k1", "k2", "k3", "k4", "k5", "k6", "k7"
+};
+
+/// @note the encoding state of a decoded instruction (prefixes, modr/m, sib, ...).
+typedef struct {
+    const unsigned char* bytes;     // raw bytes of the instruction.
+    size_t length;                  // total length of the instruction.
+    size_t modrm_at, imm_at;        // offsets of the modr/m byte and the immediate.
+    unsigned char opcode;           // last opcode byte.
+    unsigned char modrm;            // the modr/m byte (if present).
+    bool has_modrm, has_rex;        // if a modr/m byte or rex prefix are present.
+    int w, r, x, b, rp;             // rex.w/r/x/b (and evex.r') bits.
+    int vvvv, vex;                  // vex/evex extra register and the encoding (0, 1, 2).
+    int opsize;                     // effective operand size (16, 32, 64).
+    int segment;                    // segment override (-1 if none).
+    size_t disp_at, disp_len;       // displacement offset and size.
+} rda_enc_t;
+
+/**
+ * @brief read <n> bytes little-endian from <bytes> and sign-extend them.
+ *
+ * @param bytes the bytes to be read.
+ * @param n the number of bytes to read (1, 2, 4 or 8; others are zero-extended).
+ * @return the sign-extended value.
+ */
+rda_internal long long
+read_signed(const unsigned char* bytes, size_t n) {
+    unsigned long long value = 0;
+    for (size_t i = n; i > 0; i--)
+        value = (value << 8) | bytes[i - 1];
+
+    // sign-extend only the natural widths.
+    switch (n) {
+        case 1: return (signed char) value;
+        case 2: return (short) value;
+        case 4: return (int) value;
+        default: return (long long) value;
+    }
+};
+
+/**
+ * @brief read the encoding state (prefixes, vex/evex, modr/m) of an instruction.
+ *
+ * @param inst the decoded instruction.
+ * @param enc the encoding state to be filled.
+ */
+rda_internal void
+read_encoding(const rda_dec_int_t* inst, rda_enc_t* enc) {
+    memset(enc, 0, sizeof *enc);
+    enc->bytes = inst->bytes;
+    enc->length = inst->length;
+    enc->segment = -1;
+    enc->opsize = 32;
+
+    // legacy and rex prefixes.
+    bool opsize16 = false;
+    for (size_t i = 0; i < inst->prefix_count; i++) {
+        unsigned char byte = inst->bytes[i];
+        if (byte == 0x66) opsize16 = inst->instruction->has_simd_prefix != 0x66;
+        else if (byte == 0x26) enc->segment = 0;
+        else if (byte == 0x2e) enc->segment = 1;
+        else if (byte == 0x36) enc->segment = 2;
+        else if (byte == 0x3e) enc->segment = 3;
+        else if (byte == 0x64) enc->segment = 4;
+        else if (byte == 0x65) enc->segment = 5;
+        else if ((byte & 0xf0) == 0x40) {
+            enc->has_rex = true;
+            enc->w = (byte >> 3) & 1;
+            enc->r = (byte >> 2) & 1;
+            enc->x = (byte >> 1) & 1;
+            enc->b = byte & 1;
+        }
+    }
+
+    // a mandatory prefix is part of the opcode bytes in our tables, and with a
+    //  rex after it the rex takes its place there.
+    const unsigned char* op = inst->bytes + inst->prefix_count;
+    if (inst->instruction->has_simd_prefix && !inst->instruction->vex_encoding && (op[0] & 0xf0) == 0x40) {
+        enc->has_rex = true;
+        enc->w = (op[0] >> 3) & 1;
+        enc->r = (op[0] >> 2) & 1;
+        enc->x = (op[0] >> 1) & 1;
+        enc->b = op[0] & 1;
+    }
+
+    // vex/evex prefixes are part of the opcode bytes in our tables.
+    int opcode_length = inst->instruction->opcode_length;
+    if (inst->instruction->vex_encoding == 1 && op[0] == 0xc5) {
+        enc->vex = 1;
+        enc->r = !((op[1] >> 7) & 1);
+        enc->vvvv = (~op[1] >> 3) & 0xf;
+    } else if (inst->instruction->vex_encoding == 1 && op[0] == 0xc4) {
+        enc->vex = 1;
+        enc->r = !((op[1] >> 7) & 1);
+        enc->x = !((op[1] >> 6) & 1);
+        enc->b = !((op[1] >> 5) & 1);
+        enc->w = (op[2] >> 7) & 1;
+        enc->vvvv = (~op[2] >> 3) & 0xf;
+    } else if (inst->instruction->vex_encoding == 2 && op[0] == 0x62) {
+        enc->vex = 2;
+        enc->r = !((op[1] >> 7) & 1);
+        enc->x = !((op[1] >> 6) & 1);
+        enc->b = !((op[1] >> 5) & 1);
+        enc->rp = !((op[1] >> 4) & 1);
+        enc->w = (op[2] >> 7) & 1;
+        enc->vvvv = (~op[2] >> 3) & 0xf;
+    }
+    enc->opcode = op[opcode_length - 1];
+
+    // effective operand size.
+    if (enc->w) enc->opsize = 64;
+    else if (opsize16) enc->opsize = 16;
+
+    // modr/m, sib and displacement.
+    size_t at = inst->prefix_count + opcode_length;
+    enc->modrm_at = at;
+    if (inst->instruction->modrm && at < inst->length) {
+        enc->has_modrm = true;
+        enc->modrm = inst->bytes[at];
+        unsigned char mod = (enc->modrm >> 6) & 3, rm = enc->modrm & 7;
+        at++;
+        if (mod != 3) {
+            unsigned char base = rm;
+            if (rm == 4) base = inst->bytes[at++] & 7; // sib
+            enc->disp_at = at;
+            if (mod == 1) enc->disp_len = 1;
+            else if (mod == 2 || (mod == 0 && base == 5)) enc->disp_len = 4;
+            at += enc->disp_len;
+        }
+    }
+    enc->imm_at = at > inst->length ? inst->length : at;
+};
+
+/**
+ * @brief check if the token <tok> of length <n> starts with <prefix>.
+ */
+rda_internal bool
+tok_starts(const char* tok, size_t n, const char* prefix) {
+    size_t len = strlen(prefix);
+    return n >= len && strncmp(tok, prefix, len) == 0;
+};
+
+/**
+ * @brief check if the token <tok> of length <n> is exactly <word>.
+ */
+rda_internal bool
+tok_equals(const char* tok, size_t n, const char* word) {
+    return strlen(word) == n && strncmp(tok, word, n) == 0;
+};
+
+/**
+ * @brief parse the gpr size suffix of a template token ("8", "16-64", ...).
+ *
+ * @param suffix the suffix after "r" or "r/m" or "m".
+ * @param n length of the suffix.
+ * @param opsize the effective operand size.
+ * @return the size in bits (0 if unknown).
+ */
+rda_internal int
+parse_size(const char* suffix, size_t n, int opsize) {
+    if (n == 0) return 0;
+    if (tok_starts(suffix, n, "16-64")) return opsize;
+    if (tok_starts(suffix, n, "32-64")) return opsize == 64 ? 64 : 32;
+    int size = 0;
+    for (size_t i = 0; i < n && suffix[i] >= '0' && suffix[i] <= '9'; i++)
+        size = size * 10 + (suffix[i] - '0');
+    return size;
+};
+
+/**
+ * @brief build a gpr register reference of <size> bits.
+ *
+ * @param index register number (0-15).
+ * @param size size of the register in bits.
+ * @param has_rex if a rex prefix is present (spl/bpl/sil/dil vs. ah/ch/dh/bh).
+ * @return the register reference.
+ */
+rda_internal rda_reg_t
+make_gpr(int index, int size, bool has_rex) {
+    rda_reg_t reg = { RDA_REG_TY_GPR64, (unsigned char) index };
+    switch (size) {
+        case 8:
+            if (!has_rex && index >= 4 && index < 8) {
+                reg.type = RDA_REG_TY_GPR8H;
+                reg.index = (unsigned char) (index - 4);
+            } else reg.type = RDA_REG_TY_GPR8;
+            break;
+        case 16: reg.type = RDA_REG_TY_GPR16; break;
+        case 32: reg.type = RDA_REG_TY_GPR32; break;
+        default: break;
+    }
+    return reg;
+};
+
+/**
+ * @brief get the register class named by a template token ("xmm1", "k2", "r16-64", ...).
+ *
+ * @param tok the token (up to any '/').
+ * @param n the length of <tok>.
+ * @return the register class, RDA_REG_TY_GPR64 for generic gpr tokens, or none.
+ */
+rda_internal rda_reg_ty_t
+token_class(const char* tok, size_t n) {
+    if (tok_starts(tok, n, "xmm")) return RDA_REG_TY_XMM;
+    if (tok_starts(tok, n, "ymm")) return RDA_REG_TY_YMM;
+    if (tok_starts(tok, n, "zmm")) return RDA_REG_TY_ZMM;
+    if (tok_starts(tok, n, "mm")) return RDA_REG_TY_MMX;
+    if (n >= 1 && tok[0] == 'k') return RDA_REG_TY_MASK;
+    if (n >= 2 && tok[0] == 'r' && tok[1] >= '0' && tok[1] <= '9') return RDA_REG_TY_GPR64;
+    if (n >= 2 && tok[0] == 'r' && tok[1] == '/') return RDA_REG_TY_GPR64;
+    return RDA_REG_TY_NONE;
+};
+
+/**
+ * @brief get the size in bits of a register of class <type>.
+ *
+ * @param type the register class from token_class().
+ * @param gpr_size the size in bits used for gpr classes.
+ * @return the size of the register in bits.
+ */
+rda_internal int
+class_size(rda_reg_ty_t type, int gpr_size) {
+    switch (type) {
+        case RDA_REG_TY_XMM: return 128;
+        case RDA_REG_TY_YMM: return 256;
+        case RDA_REG_TY_ZMM: return 512;
+        case RDA_REG_TY_MMX: return 64;
+        case RDA_REG_TY_MASK: return 64;
+        default: return gpr_size;
+    }
+};
+
+/**
+ * @brief build a register of class <type> from an encoded register number.
+ *
+ * @param type the register class from token_class().
+ * @param index the encoded register number.
+ * @param size the gpr size in bits (ignored for vector classes).
+ * @param enc the encoding state.
+ * @return the register reference.
+ */
+rda_internal rda_reg_t
+make_reg(rda_reg_ty_t type, int index, int size, const rda_enc_t* enc) {
+    if (type == RDA_REG_TY_GPR64)
+        return make_gpr(index & 15, size, enc->has_rex);
+    if (type == RDA_REG_TY_MASK || type == RDA_REG_TY_MMX)
+        index &= 7;
+    return (rda_reg_t) { (unsigned char) type, (unsigned char) index };
+};
+
+/**
+ * @brief decode the r/m operand of the modr/m byte.
+ *
+ * @param enc the encoding state.
+ * @param type register class used if mod == 3.
+ * @param reg_size gpr size in bits used if mod == 3.
+ * @param mem_size memory size in bits used if mod != 3.
+ * @param opnd the operand to be filled.
+ */
+rda_internal void
+decode_rm(const rda_enc_t* enc, rda_reg_ty_t type, int reg_size, int mem_size, rda_opnd_t* opnd) {
+    unsigned char mod = (enc->modrm >> 6) & 3, rm = enc->modrm & 7;
+    if (mod == 3) {
+        opnd->type = RDA_OPND_TY_REG;
+        opnd->size = (unsigned short) class_size(type, reg_size);
+        opnd->reg = make_reg(type == RDA_REG_TY_NONE ? RDA_REG_TY_GPR64 : type,
+            rm | (enc->b << 3) | (enc->vex == 2 ? enc->x << 4 : 0), reg_size, enc);
+        return;
+    }
+
+    // memory operand.
+    opnd->type = RDA_OPND_TY_MEM;
+    opnd->size = (unsigned short) mem_size;
+    opnd->scale = 1;
+    if (enc->segment >= 0)
+        opnd->segment = (rda_reg_t) { RDA_REG_TY_SEG, (unsigned char) enc->segment };
+    if (rm == 4) {
+        unsigned char sib = enc->bytes[enc->modrm_at + 1];
+        unsigned char scale = (sib >> 6) & 3, index = (sib >> 3) & 7, base = sib & 7;
+        opnd->scale = (unsigned char) (1 << scale);
+        if (index != 4 || enc->x)
+            opnd->index = make_gpr(index | (enc->x << 3), 64, true);
+        if (!(base == 5 && mod == 0))
+            opnd->base = make_gpr(base | (enc->b << 3), 64, true);
+    } else if (rm == 5 && mod == 0) {
+        opnd->base = (rda_reg_t) { RDA_REG_TY_RIP, 0 };
+    } else {
+        opnd->base = make_gpr(rm | (enc->b << 3), 64, true);
+    }
+    if (enc->disp_len)
+        opnd->value = read_signed(enc->bytes + enc->disp_at, enc->disp_len);
+};
+
+/**
+ * @brief get the index of a literal gpr name ("al", "cl", "eax", "rax", ...).
+ *
+ * @param tok the token.
+ * @param n the length of <tok>.
+ * @param size pointer to where the size of the named register is written.
+ * @return the register number, or -1 if <tok> is not a literal gpr.
+ */
+rda_internal int
+literal_gpr(const char* tok, size_t n, int* size) {
+    for (int i = 0; i < 8; i++) {
+        if (tok_equals(tok, n, internal_gpr64_names[i])) { *size = 64; return i; }
+        if (tok_equals(tok, n, internal_gpr32_names[i])) { *size = 32; return i; }
+        if (tok_equals(tok, n, internal_gpr16_names[i])) { *size = 16; return i; }
+        if (i < 4 && tok_equals(tok, n, internal_gpr8_names[i])) { *size = 8; return i; }
+    }
+    return -1;
+};
+
+/**
+ * @brief decode the operands of a decoded instruction into
+ *  <operands> using the instruction template and the raw bytes.
+ *
+ * @param inst a decoded instruction.
+ * @param address the runtime address of <inst> (used for relative targets).
+ * @param operands an array of at least RDA_OPND_MAX operands.
+ * @return the number of operands decoded (0 if <inst> is invalid).
+ */
+size_t
+rda_get_operands(const rda_dec_int_t* inst, size_t address, rda_opnd_t* operands) {
+    if (!inst || !operands || !inst->valid || !inst->instruction->mnemonic)
+        return 0;
+
+    // read the encoding, and find the operand list within the template.
+    rda_enc_t enc;
+    read_encoding(inst, &enc);
+    const char* p = strchr(inst->instruction->mnemonic, ' ');
+    if (!p) return 0;
+    p++;
+
+    // push/pop and indirect branches default to 64-bit operands in long mode.
+    const char* name = inst->instruction->mnemonic;
+    int opsize = enc.opsize;
+    if ((strncmp(name, "push", 4) == 0 || strncmp(name, "pop", 3) == 0) && opsize == 32)
+        opsize = 64;
+
+    // the order in which generic register tokens are assigned.
+    size_t slot = 0;
+    size_t count = 0;
+    while (*p && count < RDA_OPND_MAX) {
+        // isolate the next token.
+        const char* end = p;
+        while (*end && *end != ',') end++;
+        size_t n = (size_t) (end - p);
+        rda_opnd_t* opnd = &operands[count];
+        memset(opnd, 0, sizeof *opnd);
+
+        // split the token on '/' (register alternative / memory).
+        const char* slash = memchr(p, '/', n);
+        int gpr_size = 0;
+        int literal = literal_gpr(p, n, &gpr_size);
+        if (slash || (p[0] == 'm' && p[1] != 'm') || p[0] == '[') {
+            // r/m operand (or a memory only operand).
+            rda_reg_ty_t type = slash ? token_class(p, n) : RDA_REG_TY_NONE;
+            const char* mem = slash ? slash + 1 : p;
+            size_t mem_n = (size_t) (end - mem);
+            int size = (mem_n > 0 && mem[0] == 'm') ? parse_size(mem + 1, mem_n - 1, opsize) : 0;
+            if (enc.has_modrm)
+                decode_rm(&enc, type, size, size, opnd);
+            else {
+                // string operations, implicit es:[rdi] or ds:[rsi].
+                bool source = strncmp(name, "lods", 4) == 0 || (strncmp(name, "cmps", 4) == 0 && count == 0) || \
+                    (strncmp(name, "movs", 4) == 0 && count == 1);
+                opnd->type = RDA_OPND_TY_MEM;
+                opnd->size = (unsigned short) size;
+                opnd->scale = 1;
+                opnd->base = make_gpr(source ? 6 : 7, 64, true);
+                opnd->segment = (rda_reg_t) { RDA_REG_TY_SEG, source ? 3 : 0 };
+            }
+        } else if (tok_starts(p, n, "imm") || tok_starts(p, n, "ptr")) {
+            opnd->type = RDA_OPND_TY_IMM;
+            size_t imm_len = enc.length - enc.imm_at;
+            opnd->size = (unsigned short) (imm_len * 8);
+            opnd->value = read_signed(enc.bytes + enc.imm_at, imm_len);
+        } else if (tok_starts(p, n, "rel")) {
+            opnd->type = RDA_OPND_TY_REL;
+            size_t imm_len = enc.length - enc.imm_at;
+            opnd->size = 64;
+            opnd->value = (long long) (address + inst->length) + read_signed(enc.bytes + enc.imm_at, imm_len);
+        } else if (tok_equals(p, n, "1")) {
+            opnd->type = RDA_OPND_TY_IMM;
+            opnd->size = 8;
+            opnd->value = 1;
+        } else if (literal >= 0) {
+            // literal register; the b0-bf family encodes the register in the opcode.
+            opnd->type = RDA_OPND_TY_REG;
+            if (inst->instruction->opcode_length == 1 && enc.opcode >= 0xb0 && enc.opcode <= 0xbf) {
+                int size = enc.opcode >= 0xb8 ? (enc.w ? 64 : 32) : 8;
+                opnd->reg = make_gpr((enc.opcode & 7) | (enc.b << 3), size, enc.has_rex);
+                opnd->size = (unsigned short) size;
+            } else {
+                if (gpr_size == 64 || (gpr_size == 32 && enc.w)) gpr_size = opsize;
+                opnd->reg = make_gpr(literal, gpr_size, enc.has_rex);
+                opnd->size = (unsigned short) gpr_size;
+            }
+        } else {
+            rda_reg_ty_t type = token_class(p, n);
+            if (type == RDA_REG_TY_NONE) {
+                // unknown token (e.g. vsib), skip it.
+                p = *end ? end + 1 : end;
+                while (*p == ' ') p++;
+                continue;
+            }
+            int size = type == RDA_REG_TY_GPR64 ? parse_size(p + 1, n - 1, opsize) : 0;
+            opnd->type = RDA_OPND_TY_REG;
+            opnd->size = (unsigned short) class_size(type, size);
+
+            // assign the register to the next encoding slot.
+            if (inst->instruction->plus_reg)
+                opnd->reg = make_reg(type, (enc.opcode & 7) | (enc.b << 3), size, &enc);
+            else if (slot == 0)
+                opnd->reg = make_reg(type, ((enc.modrm >> 3) & 7) | (enc.r << 3) | (enc.rp << 4), size, &enc);
+            else if (slot == 1 && enc.vex)
+                opnd->reg = make_reg(type, enc.vvvv, size, &enc);
+            else
+                opnd->reg = make_reg(type, (enc.modrm & 7) | (enc.b << 3), size, &enc);
+            slot++;
+        }
+        count++;
+
+        // skip to the next token.
+        p = *end ? end + 1 : end;
+        while (*p == ' ') p++;
+    }
+    return count;
+};
+
+/**
+ * @brief get the absolute target of a relative branch/call (rel8/rel32).
+ *
+ * @param inst a decoded instruction.
+ * @param address the runtime address of <inst>.
+ * @param target pointer to where the target is written.
+ * @return true if <inst> has a relative target, false otherwise.
+ */
+bool
+rda_get_branch_target(const rda_dec_int_t* inst, size_t address, size_t* target) {
+    rda_opnd_t operands[RDA_OPND_MAX];
+    size_t count = rda_get_operands(inst, address, operands);
+    for (size_t i = 0; i < count; i++) {
+        if (operands[i].type == RDA_OPND_TY_REL) {
+            *target = (size_t) operands[i].value;
+            return true;
+        }
+    }
+    return false;
+};
+
+/**
+ * @brief get the absolute address referenced by a rip-relative memory operand.
+ *
+ * @param inst a decoded instruction.
+ * @param address the runtime address of <inst>.
+ * @param target pointer to where the referenced address is written.
+ * @return true if <inst> has a rip-relative memory operand, false otherwise.
+ */
+bool
+rda_get_rip_target(const rda_dec_int_t* inst, size_t address, size_t* target) {
+    rda_opnd_t operands[RDA_OPND_MAX];
+    size_t count = rda_get_operands(inst, address, operands);
+    for (size_t i = 0; i < count; i++) {
+        if (operands[i].type == RDA_OPND_TY_MEM && operands[i].base.type == RDA_REG_TY_RIP) {
+            *target = address + inst->length + (size_t) operands[i].value;
+            return true;
+        }
+    }
+    return false;
+};
+
+/**
+ * @brief get the textual name of a register (without any syntax decoration).
+ *
+ * @param reg the register.
+ * @return a static string for <reg>, or "" for RDA_REG_TY_NONE.
+ */
+const char*
+rda_get_register_name(rda_reg_t reg) {
+    switch (reg.type) {
+        case RDA_REG_TY_GPR8: return internal_gpr8_names[reg.index & 15];
+        case RDA_REG_TY_GPR8H: return internal_gpr8h_names[reg.index & 3];
+        case RDA_REG_TY_GPR16: return internal_gpr16_names[reg.index & 15];
+        case RDA_REG_TY_GPR32: return internal_gpr32_names[reg.index & 15];
+        case RDA_REG_TY_GPR64: return internal_gpr64_names[reg.index & 15];
+        case RDA_REG_TY_MMX: return internal_mmx_names[reg.index & 7];
+        case RDA_REG_TY_XMM: return internal_vec_names[0][reg.index & 31];
+        case RDA_REG_TY_YMM: return internal_vec_names[1][reg.index & 31];
+        case RDA_REG_TY_ZMM: return internal_vec_names[2][reg.index & 31];
+        case RDA_REG_TY_MASK: return internal_mask_names[reg.index & 7];
+        case RDA_REG_TY_SEG: return internal_seg_names[reg.index % 6];
+        case RDA_REG_TY_RIP: return "rip";
+        default: return "";
+    }
+};
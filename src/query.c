@@ -0,0 +1,295 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file query.c
+ */
+#include "query.h"
+
+/*! @uses calloc, free, qsort */
+#include <stdlib.h>
+
+/*! @uses rda_internal */
+#include "lib.h"
+
+/*! @uses rda_get_operands, rda_opnd_t */
+#include "opnd.h"
+
+/// @note a row before it is split into columns.
+typedef struct {
+    size_t address;                 // runtime address.
+    const rda_dec_int_t* inst;      // the decoded instruction.
+    unsigned int function;          // index of the function.
+} rda_index_entry_t;
+
+/// @note a (key, row) pair used to order rows by a column.
+typedef struct {
+    unsigned int key, row;
+} rda_index_pair_t;
+
+/// @brief order entries by address, then by function.
+rda_internal int
+compare_entries(const void* a, const void* b) {
+    const rda_index_entry_t* x = a, *y = b;
+    if (x->address != y->address) return x->address < y->address ? -1 : 1;
+    return (x->function > y->function) - (x->function < y->function);
+};
+
+/// @brief order pairs by key, then by row.
+rda_internal int
+compare_pairs(const void* a, const void* b) {
+    const rda_index_pair_t* x = a, *y = b;
+    if (x->key != y->key) return x->key < y->key ? -1 : 1;
+    return (x->row > y->row) - (x->row < y->row);
+};
+
+/**
+ * @brief build an index over decoded functions.
+ *
+ * @param functions decoded functions.
+ * @param count the number of <functions>.
+ * @return an allocated index or 0x0 on failure.
+ */
+rda_index_t*
+rda_index_create(rda_dec_fun_t** functions, size_t count) {
+    if (!functions) return 0x0;
+
+    // gather every instruction and order them by address.
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++)
+        if (functions[i]) total += functions[i]->list.length;
+    rda_index_entry_t* entries = calloc(total ? total : 1u, sizeof *entries);
+    if (!entries) return 0x0;
+    size_t at = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (!functions[i]) continue;
+        for (size_t j = 0; j < functions[i]->list.length; j++) {
+            const rda_dec_int_t* inst = rda_get_instruction_at(functions[i], j);
+            size_t address = functions[i]->address + (size_t) (inst->bytes - functions[i]->bytes);
+            entries[at++] = (rda_index_entry_t) { address, inst, (unsigned int) i };
+        }
+    }
+    qsort(entries, total, sizeof *entries, compare_entries);
+
+    // allocate the columns.
+    rda_index_t* index = calloc(1u, sizeof *index);
+    size_t n = total ? total : 1u;
+    rda_index_pair_t* pairs = calloc(n, sizeof *pairs);
+    if (index) {
+        index->count = total;
+        index->address = calloc(n, sizeof *index->address);
+        index->id = calloc(n, sizeof *index->id);
+        index->flags = calloc(n, sizeof *index->flags);
+        index->type = calloc(n, sizeof *index->type);
+        index->operands = calloc(n, sizeof *index->operands);
+        index->function = calloc(n, sizeof *index->function);
+        index->instruction = calloc(n, sizeof *index->instruction);
+        index->by_type = calloc(n, sizeof *index->by_type);
+        index->by_id = calloc(n, sizeof *index->by_id);
+    }
+    if (!index || !pairs || !index->address || !index->id || !index->flags || !index->type || \
+        !index->operands || !index->function || !index->instruction || !index->by_type || !index->by_id) {
+        free(entries);
+        free(pairs);
+        rda_index_destroy(index);
+        return 0x0;
+    }
+
+    // fill the columns, counting the rows of every type as we go.
+    size_t type_counts[RDA_INDEX_TYPES] = { 0 };
+    for (size_t i = 0; i < total; i++) {
+        const rda_dec_int_t* inst = entries[i].inst;
+        index->address[i] = entries[i].address;
+        index->id[i] = inst->valid ? inst->id : RDA_INDEX_INVALID_ID;
+        index->flags[i] = rda_get_flags(inst);
+        index->type[i] = inst->valid && inst->instruction->type < RDA_INDEX_TYPES ? \
+            (unsigned char) inst->instruction->type : RDA_INST_TY_INVALID;
+        index->function[i] = entries[i].function;
+        index->instruction[i] = inst;
+
+        rda_opnd_t operands[RDA_OPND_MAX];
+        size_t operand_count = rda_get_operands(inst, entries[i].address, operands);
+        for (size_t j = 0; j < operand_count; j++)
+            index->operands[i] |= (unsigned char) (1u << operands[j].type);
+        type_counts[index->type[i]]++;
+    }
+    free(entries);
+
+    // per-type lists, a stable counting sort keeps every list in address order.
+    size_t fill[RDA_INDEX_TYPES];
+    for (size_t t = 0; t < RDA_INDEX_TYPES; t++) {
+        index->type_offsets[t + 1] = index->type_offsets[t] + type_counts[t];
+        fill[t] = index->type_offsets[t];
+    }
+    for (size_t i = 0; i < total; i++)
+        index->by_type[fill[index->type[i]]++] = (unsigned int) i;
+
+    // id list, ordered by (id, address).
+    for (size_t i = 0; i < total; i++)
+        pairs[i] = (rda_index_pair_t) { index->id[i], (unsigned int) i };
+    qsort(pairs, total, sizeof *pairs, compare_pairs);
+    for (size_t i = 0; i < total; i++)
+        index->by_id[i] = pairs[i].row;
+    free(pairs);
+    return index;
+};
+
+/**
+ * @brief free an index (not the functions it refers to).
+ *
+ * @param index the index to be freed.
+ */
+void
+rda_index_destroy(rda_index_t* index) {
+    if (!index) return;
+    free(index->address);
+    free(index->id);
+    free(index->flags);
+    free(index->type);
+    free(index->operands);
+    free(index->function);
+    free(index->instruction);
+    free(index->by_type);
+    free(index->by_id);
+    free(index);
+};
+
+/**
+ * @brief get the row at a position of a stream.
+ */
+rda_internal size_t
+stream_row(const rda_query_stream_t* stream, size_t position) {
+    return stream->rows ? stream->rows[position] : position;
+};
+
+/**
+ * @brief find the first position in [low, high) of a stream whose address is >= <address>.
+ *
+ * @param index the index being queried.
+ * @param stream the stream (sorted by address within [low, high)).
+ * @param low the first position.
+ * @param high the end position.
+ * @param address the address to look for.
+ * @return the position.
+ */
+rda_internal size_t
+lower_bound(const rda_index_t* index, const rda_query_stream_t* stream, size_t low, size_t high, size_t address) {
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (index->address[stream_row(stream, middle)] < address) low = middle + 1;
+        else high = middle;
+    }
+    return low;
+};
+
+/**
+ * @brief add a stream narrowed down to the address range of the query.
+ *
+ * @param cursor the cursor.
+ * @param rows the rows of the stream (0x0 for all rows).
+ * @param position the first position.
+ * @param end the end position.
+ */
+rda_internal void
+add_stream(rda_cursor_t* cursor, const unsigned int* rows, size_t position, size_t end) {
+    rda_query_stream_t* stream = &cursor->streams[cursor->stream_count++];
+    stream->rows = rows;
+    stream->position = lower_bound(cursor->index, stream, position, end, cursor->query.start);
+    stream->end = cursor->query.end ? lower_bound(cursor->index, stream, stream->position, end, cursor->query.end) : end;
+};
+
+/**
+ * @brief start a query.
+ *
+ * @param index the index to be queried.
+ * @param query the query.
+ * @param cursor the cursor to be initialized.
+ */
+void
+rda_query_begin(const rda_index_t* index, const rda_query_t* query, rda_cursor_t* cursor) {
+    *cursor = (rda_cursor_t) { .index = index };
+    if (!index || !query) return;
+    cursor->query = *query;
+
+    // walk the narrowest lists the query allows: one id, some types, or everything.
+    if (query->match_id) {
+        size_t low = 0, high = index->count;
+        while (low < high) {
+            size_t middle = low + (high - low) / 2;
+            if (index->id[index->by_id[middle]] < query->id) low = middle + 1;
+            else high = middle;
+        }
+        size_t end = low;
+        while (end < index->count && index->id[index->by_id[end]] == query->id)
+            end++;
+        add_stream(cursor, index->by_id, low, end);
+    }
+    else if (query->types) {
+        for (size_t t = 0; t < RDA_INDEX_TYPES; t++)
+            if (query->types & (1u << t))
+                add_stream(cursor, index->by_type, index->type_offsets[t], index->type_offsets[t + 1]);
+    }
+    else add_stream(cursor, 0x0, 0, index->count);
+};
+
+/**
+ * @brief get the next result of a query.
+ *
+ * @param cursor a cursor from rda_query_begin().
+ * @param row pointer to where the matching row is written.
+ * @return true if a result was found, false if the query is exhausted.
+ */
+bool
+rda_query_next(rda_cursor_t* cursor, size_t* row) {
+    const rda_index_t* index = cursor->index;
+    const rda_query_t* query = &cursor->query;
+    while (1) {
+        // take the lowest address at the head of the streams.
+        rda_query_stream_t* next = 0x0;
+        size_t best = 0;
+        for (size_t i = 0; i < cursor->stream_count; i++) {
+            rda_query_stream_t* stream = &cursor->streams[i];
+            if (stream->position == stream->end) continue;
+            size_t candidate = stream_row(stream, stream->position);
+            if (!next || index->address[candidate] < index->address[best]) {
+                next = stream;
+                best = candidate;
+            }
+        }
+        if (!next) return false;
+        next->position++;
+
+        // check the predicates the streams did not already cover.
+        if (query->match_id && query->types && !(query->types & (1u << index->type[best])))
+            continue;
+        if ((index->flags[best] & query->flags) != query->flags)
+            continue;
+        if ((index->operands[best] & query->operands) != query->operands)
+            continue;
+        if (row) *row = best;
+        return true;
+    }
+};
+
+/**
+ * @brief run a query and stream every result to a callback, in address order.
+ *
+ * @param index the index to be queried.
+ * @param query the query.
+ * @param callback the callback for every result.
+ * @param data user data passed to <callback>.
+ * @return the number of results.
+ */
+size_t
+rda_query_run(const rda_index_t* index, const rda_query_t* query, rda_query_callback_t callback, void* data) {
+    rda_cursor_t cursor;
+    rda_query_begin(index, query, &cursor);
+
+    size_t results = 0, row;
+    while (rda_query_next(&cursor, &row)) {
+        results++;
+        if (callback && !callback(index, row, data))
+            break;
+    }
+    return results;
+};
@@ -0,0 +1,435 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file sampler.c
+ */
+#define _GNU_SOURCE
+#include "sampler.h"
+
+/*! @uses calloc, free, qsort */
+#include <stdlib.h>
+
+/*! @uses memcpy */
+#include <string.h>
+
+/*! @uses sigaction, sigemptyset, siginfo_t, SIGPROF, SA_SIGINFO, SA_RESTART */
+#include <signal.h>
+
+/*! @uses ucontext_t, REG_RIP */
+#include <ucontext.h>
+
+/*! @uses setitimer, itimerval, ITIMER_PROF */
+#include <sys/time.h>
+
+/*! @uses call_once, once_flag, mtx_t, mtx_init, mtx_lock, mtx_unlock, thrd_yield */
+#include <threads.h>
+
+/*! @uses atomic_size_t, atomic_bool, atomic_uint, atomic_load_explicit, atomic_store_explicit, ... */
+#include <stdatomic.h>
+
+/*! @uses rda_internal */
+#include "lib.h"
+
+/*! @uses rda_ipmap_create, rda_ipmap_resolve_sorted, rda_ip_hit_t */
+#include "ipmap.h"
+
+/*! @uses rda_vec_t, RDA_VEC_TYPED */
+#include "vec.h"
+
+/// @note typed access to vectors of samples, hot functions and hot instructions.
+RDA_VEC_TYPED(sample_vec, size_t)
+RDA_VEC_TYPED(hot_function_vec, rda_hot_function_t)
+RDA_VEC_TYPED(hot_instruction_vec, rda_hot_instruction_t)
+
+/**
+ * @note the samples of a thread; only the sampled thread (in its signal
+ *	handler) moves <head> and only a drain (under <g_sampler_lock>) moves <tail>.
+ */
+typedef struct {
+    atomic_size_t head;             // samples pushed.
+    atomic_size_t tail;             // samples drained.
+    size_t* ips;                    // ring of <g_ring_mask> + 1 instruction pointers.
+} rda_sampler_ring_t;
+
+/// @note the rings of the running sampler, read by the handler while <g_active>.
+static rda_sampler_ring_t* g_rings;
+static size_t g_ring_count, g_ring_mask;
+
+/// @note the handler only touches the rings while <g_active>, and counts itself in <g_inflight>.
+static atomic_bool g_active;
+static atomic_uint g_inflight;
+
+/// @note threads claim a ring on their first sample of a session.
+static atomic_uint g_session;
+static atomic_size_t g_claimed;
+static atomic_size_t g_dropped;
+
+/// @note the ring of the current thread and the session it was claimed in.
+static _Thread_local rda_sampler_ring_t* t_ring __attribute__((tls_model("initial-exec")));
+static _Thread_local unsigned int t_session __attribute__((tls_model("initial-exec")));
+
+/// @note the sampler state below is only used under <g_sampler_lock>.
+static mtx_t g_sampler_lock;
+static once_flag g_sampler_once = ONCE_FLAG_INIT;
+static bool g_running;
+static struct sigaction g_previous;
+static rda_vec_t g_samples;         // samples drained and not yet reported.
+
+/// @brief initialize the sampler lock and the drained samples.
+rda_internal void
+init_sampler(void) {
+    mtx_init(&g_sampler_lock, mtx_plain);
+    sample_vec_init(&g_samples, 0x0);
+};
+
+/**
+ * @brief SIGPROF handler, push the interrupted instruction pointer into the
+ *  ring of the current thread; async-signal-safe, it only uses lock-free
+ *  atomics and initial-exec thread locals.
+ *
+ * @param signal SIGPROF.
+ * @param info unused.
+ * @param context the ucontext_t of the interrupted thread.
+ */
+rda_internal void
+take_sample(int signal, siginfo_t* info, void* context) {
+    (void) signal; (void) info;
+    atomic_fetch_add(&g_inflight, 1u);
+    if (atomic_load(&g_active)) {
+        const ucontext_t* interrupted = context;
+#if defined(__x86_64__)
+        size_t ip = (size_t) interrupted->uc_mcontext.gregs[REG_RIP];
+#elif defined(__aarch64__)
+        size_t ip = (size_t) interrupted->uc_mcontext.pc;
+#else
+#error "the sampler reads the instruction pointer on x86_64 and aarch64 only"
+#endif
+        unsigned int session = atomic_load_explicit(&g_session, memory_order_relaxed);
+        if (t_session != session) {
+            size_t slot = atomic_fetch_add_explicit(&g_claimed, 1u, memory_order_relaxed);
+            t_ring = slot < g_ring_count ? &g_rings[slot] : 0x0;
+            t_session = session;
+        }
+        rda_sampler_ring_t* ring = t_ring;
+        size_t head = ring ? atomic_load_explicit(&ring->head, memory_order_relaxed) : 0;
+        if (!ring || head - atomic_load_explicit(&ring->tail, memory_order_acquire) > g_ring_mask)
+            atomic_fetch_add_explicit(&g_dropped, 1u, memory_order_relaxed);
+        else {
+            ring->ips[head & g_ring_mask] = ip;
+            atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+        }
+    }
+    atomic_fetch_sub(&g_inflight, 1u);
+};
+
+/// @brief move the samples of every ring to <g_samples>, under <g_sampler_lock>.
+rda_internal void
+drain_rings(void) {
+    for (size_t i = 0; i < g_ring_count; i++) {
+        rda_sampler_ring_t* ring = &g_rings[i];
+        size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+        size_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        for (; tail != head; tail++) {
+            if (!sample_vec_push(&g_samples, &ring->ips[tail & g_ring_mask])) {
+                atomic_fetch_add_explicit(&g_dropped, head - tail, memory_order_relaxed);
+                break; // out of memory
+            }
+        }
+        atomic_store_explicit(&ring->tail, head, memory_order_release);
+    }
+};
+
+/**
+ * @brief start sampling the instruction pointer of the running threads, with
+ *  setitimer(ITIMER_PROF) and a SIGPROF handler that pushes every sample into
+ *  a lock-free ring of the interrupted thread; one sampler runs per process,
+ *  and the timer and handler are not shared with other profilers.
+ *
+ * @param policy how to sample, 0x0 for the defaults.
+ * @return true if the sampler was started.
+ */
+bool
+rda_sampler_start(const rda_sampler_policy_t* policy) {
+    rda_sampler_policy_t defaults = { 0 };
+    if (!policy) policy = &defaults;
+    unsigned int frequency = policy->frequency ? policy->frequency : RDA_SAMPLER_FREQUENCY;
+    size_t threads = policy->threads ? policy->threads : RDA_SAMPLER_THREADS;
+    if (threads > RDA_SAMPLER_THREADS_MAX) threads = RDA_SAMPLER_THREADS_MAX;
+    size_t ring = 1;
+    while (ring < (policy->ring ? policy->ring : RDA_SAMPLER_RING))
+        ring <<= 1;
+
+    call_once(&g_sampler_once, init_sampler);
+    mtx_lock(&g_sampler_lock);
+    bool started = false;
+    if (!g_running) {
+        rda_sampler_ring_t* rings = calloc(threads, sizeof *rings);
+        size_t* ips = calloc(threads * ring, sizeof *ips);
+        if (rings && ips) {
+            for (size_t i = 0; i < threads; i++)
+                rings[i].ips = ips + i * ring;
+            g_rings = rings;
+            g_ring_count = threads;
+            g_ring_mask = ring - 1;
+            atomic_store(&g_claimed, 0u);
+            atomic_fetch_add(&g_session, 1u);
+            atomic_store(&g_active, true);
+
+            // install the handler, then arm the timer.
+            struct sigaction action = { .sa_sigaction = take_sample, .sa_flags = SA_SIGINFO | SA_RESTART };
+            sigemptyset(&action.sa_mask);
+            long period = 1000000l / frequency;
+            if (!period) period = 1;
+            struct itimerval timer = {
+                .it_interval = { .tv_sec = period / 1000000l, .tv_usec = period % 1000000l },
+                .it_value = { .tv_sec = period / 1000000l, .tv_usec = period % 1000000l },
+            };
+            started = sigaction(SIGPROF, &action, &g_previous) == 0;
+            if (started && setitimer(ITIMER_PROF, &timer, 0x0) != 0) {
+                sigaction(SIGPROF, &g_previous, 0x0);
+                started = false;
+            }
+        }
+        if (started)
+            g_running = true;
+        else {
+            atomic_store(&g_active, false);
+            g_rings = 0x0;
+            g_ring_count = 0;
+            free(rings);
+            free(ips);
+        }
+    }
+    mtx_unlock(&g_sampler_lock);
+    return started;
+};
+
+/**
+ * @brief stop sampling; the samples taken are kept for rda_hotspots_create().
+ */
+void
+rda_sampler_stop(void) {
+    call_once(&g_sampler_once, init_sampler);
+    mtx_lock(&g_sampler_lock);
+    if (g_running) {
+        // disarm the timer and wait for handlers already past the <g_active> check.
+        struct itimerval disarmed = { 0 };
+        setitimer(ITIMER_PROF, &disarmed, 0x0);
+        atomic_store(&g_active, false);
+        while (atomic_load(&g_inflight))
+            thrd_yield();
+
+        // a sigprof still pending must not take the default action (terminate).
+        struct sigaction previous = g_previous;
+        if (!(previous.sa_flags & SA_SIGINFO) && previous.sa_handler == SIG_DFL)
+            previous.sa_handler = SIG_IGN;
+        sigaction(SIGPROF, &previous, 0x0);
+
+        drain_rings();
+        free(g_rings[0].ips);
+        free(g_rings);
+        g_rings = 0x0;
+        g_ring_count = 0;
+        g_running = false;
+    }
+    mtx_unlock(&g_sampler_lock);
+};
+
+/// @brief stop the sampler and free the samples that were never reported.
+__attribute__((destructor)) static void
+free_samples(void) {
+    rda_sampler_stop();
+    rda_vec_free(&g_samples);
+};
+
+/// @brief qsort comparator, instruction pointers in ascending order.
+rda_internal int
+compare_samples(const void* a, const void* b) {
+    size_t x = *(const size_t*) a, y = *(const size_t*) b;
+    return (x > y) - (x < y);
+};
+
+/// @brief qsort comparator, functions by address, then the same symbols together.
+rda_internal int
+compare_hot_addresses(const void* a, const void* b) {
+    const rda_hot_function_t* x = a, * y = b;
+    if (x->symbol->address != y->symbol->address) return x->symbol->address < y->symbol->address ? -1 : 1;
+    return (x->symbol > y->symbol) - (x->symbol < y->symbol);
+};
+
+/// @brief qsort comparator, the most sampled function first, then by address.
+rda_internal int
+compare_hot_functions(const void* a, const void* b) {
+    const rda_hot_function_t* x = a, * y = b;
+    if (x->samples != y->samples) return x->samples < y->samples ? 1 : -1;
+    return (x->symbol->address > y->symbol->address) - (x->symbol->address < y->symbol->address);
+};
+
+/// @brief qsort comparator, the most sampled instruction first, then by address.
+rda_internal int
+compare_hot_instructions(const void* a, const void* b) {
+    const rda_hot_instruction_t* x = a, * y = b;
+    if (x->samples != y->samples) return x->samples < y->samples ? 1 : -1;
+    return (x->address > y->address) - (x->address < y->address);
+};
+
+/**
+ * @brief take the samples collected so far (the sampler may be running) and
+ *  attribute them to functions through the process-wide symbol table, and to
+ *  instructions and types by decoding every sampled function once.
+ *
+ * @return an allocated report or 0x0 on failure.
+ */
+rda_hotspots_t*
+rda_hotspots_create(void) {
+    // take the samples, in address order.
+    call_once(&g_sampler_once, init_sampler);
+    mtx_lock(&g_sampler_lock);
+    if (g_running) drain_rings();
+    rda_vec_t samples = g_samples;
+    sample_vec_init(&g_samples, 0x0);
+    size_t dropped = atomic_exchange(&g_dropped, 0u);
+    mtx_unlock(&g_sampler_lock);
+    size_t count = samples.length;
+    size_t* ips = sample_vec_data(&samples);
+    qsort(ips, count, sizeof *ips, compare_samples);
+
+    rda_hotspots_t* hotspots = calloc(1u, sizeof *hotspots);
+    if (!hotspots) {
+        rda_vec_free(&samples);
+        return 0x0;
+    }
+    hotspots->samples = count;
+    hotspots->dropped = dropped;
+
+    // the sampled functions; consecutive samples mostly share one, but a function nested in
+    // another (a sized symbol inside a sized symbol) interrupts the samples of the outer one.
+    rda_vec_t functions, instructions;
+    hot_function_vec_init(&functions, 0x0);
+    hot_instruction_vec_init(&instructions, 0x0);
+    const rda_symtab_t* table = rda_get_symtab();
+    bool complete = true;
+    for (size_t i = 0; i < count && complete; i++) {
+        const rda_symbol_t* symbol = rda_symtab_lookup(table, ips[i]);
+        if (!symbol || !symbol->size) {
+            hotspots->unresolved++;
+            continue;
+        }
+        rda_hot_function_t* last = functions.length ? hot_function_vec_at(&functions, functions.length - 1) : 0x0;
+        if (last && last->symbol == symbol) {
+            last->samples++;
+            continue;
+        }
+        rda_hot_function_t function = { .symbol = symbol, .samples = 1u };
+        complete = hot_function_vec_push(&functions, &function) != 0x0;
+    }
+
+    // in address order, once each; of two at the same address, the larger one takes the samples.
+    rda_hot_function_t* hot = hot_function_vec_data(&functions);
+    qsort(hot, functions.length, sizeof *hot, compare_hot_addresses);
+    size_t function_count = 0;
+    for (size_t i = 0; i < functions.length; i++) {
+        rda_hot_function_t* last = function_count ? &hot[function_count - 1] : 0x0;
+        if (last && last->symbol->address == hot[i].symbol->address) {
+            if (hot[i].symbol->size > last->symbol->size) last->symbol = hot[i].symbol;
+            last->samples += hot[i].samples;
+            continue;
+        }
+        hot[function_count++] = hot[i];
+    }
+
+    // decode every function once, up to the next one at the most (so a nested function clips
+    // the one containing it), and resolve the samples.
+    rda_dec_fun_t** decoded = calloc(function_count ? function_count : 1u, sizeof *decoded);
+    rda_ip_hit_t* hits = calloc(count ? count : 1u, sizeof *hits);
+    rda_ipmap_t* map = 0x0;
+    if (complete && decoded && hits) {
+        rda_range_policy_t policy = { 0 };
+        for (size_t i = 0; i < function_count; i++) {
+            size_t budget = hot[i].symbol->size;
+            if (i + 1 < function_count && hot[i + 1].symbol->address - hot[i].symbol->address < budget)
+                budget = hot[i + 1].symbol->address - hot[i].symbol->address;
+            decoded[i] = hot[i].function = rda_disassemble_range64((void*) hot[i].symbol->address, budget, &policy);
+        }
+        map = rda_ipmap_create(decoded, function_count);
+    }
+    size_t resolved = map ? rda_ipmap_resolve_sorted(map, ips, count, hits) : 0;
+    for (size_t i = 0; map && i < count && complete; i++) {
+        if (!hits[i].inst) continue;
+        hotspots->types[hits[i].type]++;
+        rda_hot_instruction_t* last = instructions.length ? \
+            hot_instruction_vec_at(&instructions, instructions.length - 1) : 0x0;
+        if (last && last->address == hits[i].address) {
+            last->samples++;
+            continue;
+        }
+        rda_hot_instruction_t instruction = { .address = hits[i].address, .function = hits[i].function,
+            .inst = hits[i].inst, .samples = 1u };
+        complete = hot_instruction_vec_push(&instructions, &instruction) != 0x0;
+    }
+    hotspots->types[RDA_INST_TY_INVALID] += count - hotspots->unresolved - resolved;
+
+    // the report owns the decoded functions, ordered by samples.
+    size_t* addresses = calloc(function_count ? function_count : 1u, sizeof *addresses);
+    size_t* ranks = calloc(function_count ? function_count : 1u, sizeof *ranks);
+    hotspots->function_count = function_count;
+    hotspots->functions = calloc(function_count ? function_count : 1u, sizeof *hotspots->functions);
+    hotspots->instruction_count = instructions.length;
+    hotspots->instructions = calloc(instructions.length ? instructions.length : 1u, sizeof *hotspots->instructions);
+    if (!map || !complete || !addresses || !ranks || !hotspots->functions || !hotspots->instructions) {
+        for (size_t i = 0; decoded && i < function_count; i++)
+            rda_free_function(decoded[i]);
+        free(hotspots->functions);
+        free(hotspots->instructions);
+        free(hotspots);
+        hotspots = 0x0;
+    }
+    else {
+        for (size_t i = 0; i < function_count; i++)
+            addresses[i] = hot[i].symbol->address;
+        memcpy(hotspots->functions, hot, function_count * sizeof *hot);
+        qsort(hotspots->functions, function_count, sizeof *hotspots->functions, compare_hot_functions);
+
+        // instructions refer to functions by their rank; <addresses> is still in address order.
+        for (size_t i = 0; i < function_count; i++) {
+            size_t low = 0, high = function_count;
+            while (low < high) {
+                size_t middle = low + (high - low) / 2;
+                if (addresses[middle] < hotspots->functions[i].symbol->address) low = middle + 1;
+                else high = middle;
+            }
+            ranks[low] = i;
+        }
+        if (instructions.length)
+            memcpy(hotspots->instructions, hot_instruction_vec_data(&instructions),
+                instructions.length * sizeof *hotspots->instructions);
+        for (size_t i = 0; i < instructions.length; i++)
+            hotspots->instructions[i].function = ranks[hotspots->instructions[i].function];
+        qsort(hotspots->instructions, instructions.length, sizeof *hotspots->instructions, compare_hot_instructions);
+    }
+    rda_ipmap_destroy(map);
+    free(addresses);
+    free(ranks);
+    free(decoded);
+    free(hits);
+    rda_vec_free(&functions);
+    rda_vec_free(&instructions);
+    rda_vec_free(&samples);
+    return hotspots;
+};
+
+/**
+ * @brief free a report and the functions it decoded.
+ *
+ * @param hotspots the report to be freed.
+ */
+void
+rda_hotspots_destroy(rda_hotspots_t* hotspots) {
+    if (!hotspots) return;
+    for (size_t i = 0; i < hotspots->function_count; i++)
+        rda_free_function(hotspots->functions[i].function);
+    free(hotspots->functions);
+    free(hotspots->instructions);
+    free(hotspots);
+};
@@ -0,0 +1,388 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file sig.c
+ */
+#define _GNU_SOURCE
+#include "sig.h"
+
+/*! @uses calloc, free */
+#include <stdlib.h>
+
+/*! @uses memset */
+#include <string.h>
+
+/*! @uses uint32_t, uint64_t */
+#include <stdint.h>
+
+/*! @uses dl_iterate_phdr, ElfW */
+#include <link.h>
+
+/*! @uses _mm256_*, _mm512_* */
+#include <immintrin.h>
+
+/*! @uses rda_internal */
+#include "lib.h"
+
+/*! @uses decode_into, rda_dec_int_t */
+#include "decode.h"
+
+/**
+ * @brief parse a single hex digit or a '?' wildcard.
+ *
+ * @param c the character to be parsed.
+ * @param nibble pointer to where the value is written.
+ * @return 1 for a hex digit, 0 for a wildcard, -1 otherwise.
+ */
+rda_internal int
+parse_nibble(char c, unsigned char* nibble) {
+    *nibble = 0;
+    if (c == '?') return 0;
+    if (c >= '0' && c <= '9') *nibble = (unsigned char) (c - '0');
+    else if (c >= 'a' && c <= 'f') *nibble = (unsigned char) (c - 'a' + 10);
+    else if (c >= 'A' && c <= 'F') *nibble = (unsigned char) (c - 'A' + 10);
+    else return -1;
+    return 1;
+};
+
+/**
+ * @brief check if a byte is too common in code to be a good anchor.
+ *
+ * @param byte the byte to be checked.
+ * @return true for 00, ff, 90 (nop), cc (int3) and 48 (rex.w).
+ */
+rda_internal bool
+is_common_byte(unsigned char byte) {
+    return byte == 0x00 || byte == 0xff || byte == 0x90 || byte == 0xcc || byte == 0x48;
+};
+
+/**
+ * @brief compile a signature in the form "48 8b 05 ?? ?? ?? ?? 48 85 c0";
+ *  "?" and "??" are wildcard bytes, "4?" and "?8" are wildcard nibbles.
+ *
+ * @param pattern the signature text.
+ * @param sig the compiled signature to be written to.
+ * @return true on success, false if <pattern> is malformed, longer than
+ *  RDA_SIG_MAX bytes or has no fully known byte.
+ */
+bool
+rda_sig_compile(const char* pattern, rda_sig_t* sig) {
+    if (!pattern || !sig) return false;
+    memset(sig, 0, sizeof *sig);
+
+    // parse every whitespace separated token into a value/mask byte.
+    const char* ptr = pattern;
+    while (*ptr) {
+        if (*ptr == ' ' || *ptr == '\t') {
+            ptr++;
+            continue;
+        }
+        if (sig->length == RDA_SIG_MAX)
+            return false;
+
+        unsigned char high, low;
+        int known_high = parse_nibble(ptr[0], &high), known_low;
+        if (known_high < 0) return false;
+        if (ptr[1] == '\0' || ptr[1] == ' ' || ptr[1] == '\t') {
+            // a single character token is only valid as a wildcard byte.
+            if (known_high != 0) return false;
+            known_low = 0, low = 0;
+            ptr += 1;
+        } else {
+            known_low = parse_nibble(ptr[1], &low);
+            if (known_low < 0) return false;
+            ptr += 2;
+        }
+        sig->value[sig->length] = (unsigned char) (high << 4 | low);
+        sig->mask[sig->length++] = (unsigned char) ((known_high ? 0xf0 : 0) | (known_low ? 0x0f : 0));
+    }
+
+    // pick the anchor, prefer two uncommon known bytes, then any two known bytes, then one.
+    bool found = false;
+    for (int pass = 0; pass < 3 && !found; pass++) {
+        for (size_t i = 0; i < sig->length && !found; i++) {
+            bool known = sig->mask[i] == 0xff;
+            bool next = i + 1 < sig->length && sig->mask[i + 1] == 0xff;
+            bool rare = !is_common_byte(sig->value[i]) && next && !is_common_byte(sig->value[i + 1]);
+            if ((pass == 0 && known && next && rare) || (pass == 1 && known && next) || (pass == 2 && known)) {
+                sig->anchor = i;
+                sig->pair = pass < 2;
+                found = true;
+            }
+        }
+    }
+    return found;
+};
+
+/// @note the state of a single scan over a region.
+typedef struct {
+    const unsigned char* bytes;     // the start of the region.
+    size_t size;                    // the size of the region.
+    const rda_sig_t* sigs;          // the signatures.
+    size_t count;                   // the number of signatures.
+    uint64_t* boundaries;           // instruction start bitmap (or 0x0), see is_boundary().
+    size_t decoded;                 // the offset the linear decode has reached in <boundaries>.
+    rda_sig_callback_t callback;    // the match callback.
+    void* data;                     // user data for <callback>.
+    size_t matches;                 // matches reported so far.
+    bool stopped;                   // if the callback asked to stop.
+} rda_sig_scan_t;
+
+/**
+ * @brief check whether an offset starts an instruction of a linear decode from
+ *  the start of the region; the decode only advances up to the candidates
+ *  checked so far, which come block by block.
+ *
+ * @param scan the scan state.
+ * @param position the offset in the region.
+ * @return true if an instruction starts at <position>.
+ */
+rda_internal bool
+is_boundary(rda_sig_scan_t* scan, size_t position) {
+    while (scan->decoded <= position) {
+        size_t offset = scan->decoded;
+        scan->boundaries[offset / 64] |= 1ull << (offset % 64);
+        rda_dec_int_t inst;
+        memset(&inst, 0, sizeof inst);
+        size_t available = scan->size - offset < 15 ? scan->size - offset : 15;
+        decode_into(scan->bytes + offset, available, &inst);
+        scan->decoded += inst.length ? inst.length : 1;
+    }
+    return scan->boundaries[position / 64] >> (position % 64) & 1;
+};
+
+/**
+ * @brief verify a candidate position of a signature and report it.
+ *
+ * @param scan the scan state.
+ * @param index the index of the signature.
+ * @param position the offset of the candidate in the region.
+ * @return false if the scan should stop.
+ */
+rda_internal bool
+verify_and_report(rda_sig_scan_t* scan, size_t index, size_t position) {
+    const rda_sig_t* sig = &scan->sigs[index];
+    if (position + sig->length > scan->size)
+        return true;
+
+    const unsigned char* match = scan->bytes + position;
+    for (size_t i = 0; i < sig->length; i++)
+        if ((match[i] & sig->mask[i]) != sig->value[i])
+            return true;
+    if (scan->boundaries && !is_boundary(scan, position))
+        return true;
+
+    scan->matches++;
+    if (scan->callback && !scan->callback(index, match, scan->data))
+        scan->stopped = true;
+    return !scan->stopped;
+};
+
+/**
+ * @brief report every candidate bit of a block mask.
+ *
+ * @param scan the scan state.
+ * @param index the index of the signature.
+ * @param position the offset of the block in the region.
+ * @param candidates one bit per candidate position in the block.
+ * @return false if the scan should stop.
+ */
+rda_internal bool
+report_candidates(rda_sig_scan_t* scan, size_t index, size_t position, uint64_t candidates) {
+    while (candidates) {
+        if (!verify_and_report(scan, index, position + __builtin_ctzll(candidates)))
+            return false;
+        candidates &= candidates - 1;
+    }
+    return true;
+};
+
+/**
+ * @brief scan 64-byte blocks with avx-512 byte compares.
+ *
+ * @param scan the scan state.
+ * @return the offset where the vector loop stopped.
+ */
+__attribute__((target("avx512f,avx512bw")))
+rda_internal size_t
+scan_avx512(rda_sig_scan_t* scan) {
+    size_t position = 0;
+    for (; position + 64 + RDA_SIG_MAX <= scan->size && !scan->stopped; position += 64) {
+        const unsigned char* block = scan->bytes + position;
+        for (size_t i = 0; i < scan->count; i++) {
+            const rda_sig_t* sig = &scan->sigs[i];
+            __m512i first = _mm512_loadu_si512((const void*) (block + sig->anchor));
+            uint64_t candidates = _mm512_cmpeq_epi8_mask(first, _mm512_set1_epi8((char) sig->value[sig->anchor]));
+            if (sig->pair && candidates) {
+                __m512i second = _mm512_loadu_si512((const void*) (block + sig->anchor + 1));
+                candidates &= _mm512_cmpeq_epi8_mask(second, _mm512_set1_epi8((char) sig->value[sig->anchor + 1]));
+            }
+            if (candidates && !report_candidates(scan, i, position, candidates))
+                break;
+        }
+    }
+    return position;
+};
+
+/**
+ * @brief scan 32-byte blocks with avx2 byte compares.
+ *
+ * @param scan the scan state.
+ * @return the offset where the vector loop stopped.
+ */
+__attribute__((target("avx2")))
+rda_internal size_t
+scan_avx2(rda_sig_scan_t* scan) {
+    size_t position = 0;
+    for (; position + 32 + RDA_SIG_MAX <= scan->size && !scan->stopped; position += 32) {
+        const unsigned char* block = scan->bytes + position;
+        for (size_t i = 0; i < scan->count; i++) {
+            const rda_sig_t* sig = &scan->sigs[i];
+            __m256i first = _mm256_loadu_si256((const __m256i*) (block + sig->anchor));
+            uint32_t candidates = (uint32_t) _mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(first, _mm256_set1_epi8((char) sig->value[sig->anchor])));
+            if (sig->pair && candidates) {
+                __m256i second = _mm256_loadu_si256((const __m256i*) (block + sig->anchor + 1));
+                candidates &= (uint32_t) _mm256_movemask_epi8(
+                    _mm256_cmpeq_epi8(second, _mm256_set1_epi8((char) sig->value[sig->anchor + 1])));
+            }
+            if (candidates && !report_candidates(scan, i, position, candidates))
+                break;
+        }
+    }
+    return position;
+};
+
+/**
+ * @brief scan a region of memory for many signatures in a single pass; every
+ *  block of the region is loaded once and tested against all signatures.
+ *  matches are reported block by block, so they are only roughly ordered.
+ *
+ * @param bytes the start of the region.
+ * @param size the size of the region in bytes.
+ * @param sigs the compiled signatures.
+ * @param count the number of <sigs>.
+ * @param boundary if true, only report matches that start on an instruction
+ *  boundary of a linear decode from <bytes>.
+ * @param callback the callback for every match.
+ * @param data user data passed to <callback>.
+ * @return the number of matches reported.
+ */
+size_t
+rda_sig_scan(const unsigned char* bytes, size_t size, const rda_sig_t* sigs, size_t count,
+    bool boundary, rda_sig_callback_t callback, void* data) {
+    if (!bytes || !sigs || !count || !size) return 0;
+
+    rda_sig_scan_t scan = {
+        .bytes = bytes, .size = size, .sigs = sigs, .count = count,
+        .callback = callback, .data = data,
+    };
+    if (boundary) {
+        scan.boundaries = calloc(size / 64 + 1, sizeof *scan.boundaries);
+        if (!scan.boundaries) return 0;
+    }
+
+    // vector loop over whole blocks, picked by what the cpu supports.
+    size_t position = 0;
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512bw"))
+        position = scan_avx512(&scan);
+    else if (__builtin_cpu_supports("avx2"))
+        position = scan_avx2(&scan);
+
+    // scalar loop for the tail (or everything without avx2).
+    for (; position < size && !scan.stopped; position++) {
+        for (size_t i = 0; i < count && !scan.stopped; i++) {
+            const rda_sig_t* sig = &sigs[i];
+            if (position + sig->length > size || bytes[position + sig->anchor] != sig->value[sig->anchor])
+                continue;
+            verify_and_report(&scan, i, position);
+        }
+    }
+    free(scan.boundaries);
+    return scan.matches;
+};
+
+/// @note the maximum number of executable segments of a module we scan.
+#define RDA_SIG_SEGMENTS 8
+
+/// @note state passed through dl_iterate_phdr to find the executable segments of a module.
+typedef struct {
+    size_t address;                 // the address to look for.
+    size_t starts[RDA_SIG_SEGMENTS], sizes[RDA_SIG_SEGMENTS]; // output segments.
+    size_t count;                   // number of output segments.
+} rda_sig_module_t;
+
+/**
+ * @brief dl_iterate_phdr callback, collect the executable segments of the module
+ *  containing the address.
+ */
+rda_internal int
+find_segments(struct dl_phdr_info* info, size_t size, void* data) {
+    (void) size;
+    rda_sig_module_t* query = data;
+
+    // is the address within one of the loaded segments?
+    bool within = false;
+    for (size_t i = 0; i < info->dlpi_phnum && !within; i++) {
+        const ElfW(Phdr)* phdr = &info->dlpi_phdr[i];
+        size_t start = info->dlpi_addr + phdr->p_vaddr;
+        if (phdr->p_type == PT_LOAD && query->address >= start && query->address < start + phdr->p_memsz)
+            within = true;
+    }
+    if (!within) return 0;
+
+    for (size_t i = 0; i < info->dlpi_phnum && query->count < RDA_SIG_SEGMENTS; i++) {
+        const ElfW(Phdr)* phdr = &info->dlpi_phdr[i];
+        if (phdr->p_type != PT_LOAD || !(phdr->p_flags & PF_X))
+            continue;
+        query->starts[query->count] = info->dlpi_addr + phdr->p_vaddr;
+        query->sizes[query->count++] = phdr->p_memsz;
+    }
+    return 1;
+};
+
+/// @note forwards matches of a module scan and remembers if the callback stopped it.
+typedef struct {
+    rda_sig_callback_t callback;    // the user callback.
+    void* data;                     // user data for <callback>.
+    bool stopped;                   // if the callback asked to stop.
+} rda_sig_relay_t;
+
+/**
+ * @brief rda_sig_callback_t relay for module scans.
+ */
+rda_internal bool
+relay_match(size_t index, const unsigned char* match, void* data) {
+    rda_sig_relay_t* relay = data;
+    if (relay->callback && !relay->callback(index, match, relay->data))
+        relay->stopped = true;
+    return !relay->stopped;
+};
+
+/**
+ * @brief scan every executable segment of the loaded module containing <module>.
+ *
+ * @param module any address within the module.
+ * @param sigs the compiled signatures.
+ * @param count the number of <sigs>.
+ * @param boundary see rda_sig_scan().
+ * @param callback the callback for every match.
+ * @param data user data passed to <callback>.
+ * @return the number of matches reported.
+ */
+size_t
+rda_sig_scan_module(const void* module, const rda_sig_t* sigs, size_t count,
+    bool boundary, rda_sig_callback_t callback, void* data) {
+    rda_sig_module_t query = { .address = (size_t) module };
+    dl_iterate_phdr(find_segments, &query);
+
+    // scan the segments in order until the callback stops us.
+    rda_sig_relay_t relay = { .callback = callback, .data = data };
+    size_t matches = 0;
+    for (size_t i = 0; i < query.count && !relay.stopped; i++)
+        matches += rda_sig_scan((const unsigned char*) query.starts[i], query.sizes[i],
+            sigs, count, boundary, relay_match, &relay);
+    return matches;
+};
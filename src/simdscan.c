@@ -0,0 +1,289 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file simdscan.c
+ */
+#define _GNU_SOURCE
+#include "simdscan.h"
+
+/*! @uses calloc, free */
+#include <stdlib.h>
+
+/*! @uses USHRT_MAX */
+#include <limits.h>
+
+/*! @uses STT_FUNC */
+#include <elf.h>
+
+/*! @uses sysconf, _SC_NPROCESSORS_ONLN */
+#include <unistd.h>
+
+/*! @uses thrd_t, thrd_create, thrd_join, call_once, once_flag */
+#include <threads.h>
+
+/*! @uses atomic_size_t, atomic_fetch_add */
+#include <stdatomic.h>
+
+/*! @uses rda_internal */
+#include "lib.h"
+
+/*! @uses rda_get_branch_target */
+#include "opnd.h"
+
+/*! @uses rda_get_memmap, rda_memmap_lookup */
+#include "memmap.h"
+
+/*! @uses RDA_INT_SIMD_VECTOR_FIRST */
+#include "simdx64.h"
+
+/*! @uses decode_into */
+#include "decode.h"
+
+/// @note the rows that clear the upper halves, see rda_get_row_id().
+static unsigned short g_vzeroupper = USHRT_MAX, g_vzeroall = USHRT_MAX;
+static once_flag g_vzero_once = ONCE_FLAG_INIT;
+
+/// @brief look up the rows that clear the upper halves.
+rda_internal void
+find_vzero_rows(void) {
+    rda_get_row_id("vzeroupper", &g_vzeroupper);
+    rda_get_row_id("vzeroall", &g_vzeroall);
+};
+
+/**
+ * @brief account for an instruction of a function in its simd usage.
+ *
+ * @param usage the usage of the function.
+ * @param inst the decoded instruction.
+ * @param address the runtime address of <inst>.
+ * @param start the start of the function.
+ * @param end the end of the function.
+ * @param dirty the upper state, true while the upper halves are dirty.
+ */
+rda_internal void
+note_simd_instruction(rda_simd_usage_t* usage, const rda_dec_int_t* inst, size_t address,
+    size_t start, size_t end, bool* dirty) {
+    const rda_int_t* row = inst->instruction;
+    usage->instructions++;
+    usage->types[row->type]++;
+    if ((inst->id & RDA_ROW_SIMD) && (inst->id & ~RDA_ROW_SIMD) >= RDA_INT_SIMD_VECTOR_FIRST) {
+        usage->generic++;
+        usage->flags |= RDA_SIMD_FL_GENERIC;
+    }
+    if (inst->id == g_vzeroupper || inst->id == g_vzeroall) {
+        *dirty = false;
+        return;
+    }
+
+    // the width of simd operations, and what they do to the upper state.
+    bool legacy_sse = !row->vex_encoding && row->type >= RDA_INST_TY_SSE && row->type <= RDA_INST_TY_SSE4_2;
+    if (row->simd_size == 256) {
+        usage->ops_256++;
+        usage->flags |= RDA_SIMD_FL_256;
+    }
+    else if (row->simd_size == 512) {
+        usage->ops_512++;
+        usage->flags |= RDA_SIMD_FL_512;
+    }
+    if (row->vex_encoding && row->simd_size >= 256)
+        *dirty = true;
+    else if (legacy_sse && *dirty) {
+        usage->transitions++;
+        usage->flags |= RDA_SIMD_FL_TRANSITION;
+    }
+
+    // leaving the function with the upper halves dirty penalizes the sse code it runs next.
+    if (!*dirty || !(inst->flags & RDA_INST_FL_BRANCH)) return;
+    size_t target;
+    bool leaves = (inst->flags & (RDA_INST_FL_CALL | RDA_INST_FL_RET)) || \
+        ((inst->flags & RDA_INST_FL_TERM) && (!rda_get_branch_target(inst, address, &target) || \
+        target < start || target >= end));
+    if (leaves) {
+        usage->dirty_exits++;
+        usage->flags |= RDA_SIMD_FL_DIRTY_EXIT;
+    }
+};
+
+/**
+ * @brief note where decoding a function stopped, and whether it stopped at a
+ *  vex/evex instruction (c4, c5 or 62 past the legacy prefixes).
+ *
+ * @param usage the usage of the function.
+ * @param bytes the bytes of the invalid instruction.
+ * @param size the number of readable <bytes>.
+ * @param offset the offset of <bytes> within the function.
+ */
+rda_internal void
+note_simd_stop(rda_simd_usage_t* usage, const unsigned char* bytes, size_t size, size_t offset) {
+    usage->complete = false;
+    usage->stop = offset;
+    size_t i = 0;
+    while (i < size && i < 4 && (bytes[i] == 0x66 || bytes[i] == 0x67 || bytes[i] == 0xf2 || bytes[i] == 0xf3))
+        i++;
+    if (i < size && (bytes[i] == 0xc4 || bytes[i] == 0xc5 || bytes[i] == 0x62))
+        usage->flags |= RDA_SIMD_FL_UNDECODED;
+};
+
+/**
+ * @brief analyze the simd usage of a decoded amd64 function.
+ *
+ * @param function the function.
+ * @param usage the usage to be written to.
+ */
+void
+rda_simd_analyze(const rda_dec_fun_t* function, rda_simd_usage_t* usage) {
+    if (!usage) return;
+    *usage = (rda_simd_usage_t) { .complete = true };
+    if (!function) return;
+    call_once(&g_vzero_once, find_vzero_rows);
+    bool dirty = false;
+    size_t end = function->address + function->length;
+    for (size_t i = 0; i < function->list.length; i++) {
+        const rda_dec_int_t* inst = rda_inst_vec_at(&function->list, i);
+        size_t offset = (size_t) (inst->bytes - function->bytes);
+        if (!inst->valid) {
+            note_simd_stop(usage, inst->bytes, function->length > offset ? function->length - offset : 0, offset);
+            break;
+        }
+        size_t address = function->address + offset;
+        note_simd_instruction(usage, inst, address, function->address, end, &dirty);
+    }
+};
+
+/// @note the functions of a sweep, shared by its workers.
+typedef struct {
+    rda_simd_usage_t* usages;       // one per function, ordered by address, <symbol> set.
+    size_t count, batch;            // number of <usages>, and functions per claim.
+    atomic_size_t next;             // the next function to be claimed.
+    const rda_memmap_t* map;        // readable memory, 0x0 if unknown.
+} rda_simd_work_t;
+
+/**
+ * @brief decode a function of a sweep in place, up to its end, the end of
+ *  readable memory or its first invalid instruction.
+ *
+ * @param work the sweep.
+ * @param usage the usage of the function.
+ */
+rda_internal void
+sweep_function(const rda_simd_work_t* work, rda_simd_usage_t* usage) {
+    size_t start = usage->symbol->address, size = usage->symbol->size;
+    if (work->map) {
+        const rda_mapping_t* mapping = rda_memmap_lookup(work->map, start);
+        size_t readable = mapping && (mapping->rights & RDA_MAP_READ) ? mapping->reach - start : 0;
+        if (readable < size) size = readable;
+    }
+
+    usage->complete = true;
+    bool dirty = false;
+    for (size_t offset = 0; offset < usage->symbol->size; ) {
+        rda_dec_int_t inst = { 0 };
+        size_t available = offset < size ? (size - offset < 15 ? size - offset : 15) : 0;
+        if (available)
+            decode_into((const unsigned char*) start + offset, available, &inst);
+        if (!inst.valid) {
+            note_simd_stop(usage, (const unsigned char*) start + offset, available, offset);
+            break;
+        }
+        note_simd_instruction(usage, &inst, start + offset, start, start + usage->symbol->size, &dirty);
+        offset += inst.length;
+    }
+};
+
+/**
+ * @brief worker thread, sweep batches of functions until there are none left.
+ */
+rda_internal int
+simd_worker(void* data) {
+    rda_simd_work_t* work = data;
+    for (size_t first; (first = atomic_fetch_add(&work->next, work->batch)) < work->count; ) {
+        size_t last = work->count - first < work->batch ? work->count : first + work->batch;
+        for (size_t i = first; i < last; i++)
+            sweep_function(work, &work->usages[i]);
+    }
+    return 0;
+};
+
+/**
+ * @brief sweep the sized functions of the process-wide symbol table (every
+ *  loaded module) for simd usage; batches of functions are decoded in place
+ *  by a pool of workers. simd rows are only decoded with
+ *  rda_context_t::use_simd.
+ *
+ * @param policy how to sweep, 0x0 for the defaults.
+ * @return an allocated report or 0x0 on failure.
+ */
+rda_simd_report_t*
+rda_simd_sweep(const rda_simd_policy_t* policy) {
+    rda_simd_policy_t defaults = { 0 };
+    if (!policy) policy = &defaults;
+    const rda_symtab_t* table = rda_get_symtab();
+    if (!table) return 0x0;
+    call_once(&g_vzero_once, find_vzero_rows);
+
+    // every sized function once, the preferred alias of every address.
+    rda_simd_work_t work = { .batch = policy->batch ? policy->batch : RDA_SIMD_BATCH, .map = rda_get_memmap() };
+    work.usages = calloc(table->count ? table->count : 1u, sizeof *work.usages);
+    rda_simd_report_t* report = calloc(1u, sizeof *report);
+    if (!work.usages || !report) {
+        free(work.usages);
+        free(report);
+        return 0x0;
+    }
+    for (size_t i = 0; i < table->count; i++) {
+        const rda_symbol_t* symbol = &table->symbols[i];
+        if (symbol->type != STT_FUNC || !symbol->size) continue;
+        if (work.count && work.usages[work.count - 1].symbol->address == symbol->address) continue;
+        work.usages[work.count++].symbol = symbol;
+    }
+
+    // the calling thread is worker 0, the others run on their own threads.
+    size_t workers = policy->workers;
+    if (!workers) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        workers = online > 0 ? (size_t) online : 1;
+    }
+    if (workers > RDA_SIMD_WORKERS_MAX) workers = RDA_SIMD_WORKERS_MAX;
+    size_t batches = (work.count + work.batch - 1) / work.batch;
+    if (workers > batches) workers = batches ? batches : 1;
+    thrd_t threads[RDA_SIMD_WORKERS_MAX];
+    size_t started = 1;
+    for (; started < workers; started++)
+        if (thrd_create(&threads[started], simd_worker, &work) != thrd_success)
+            break;
+    simd_worker(&work);
+    for (size_t i = 1; i < started; i++)
+        thrd_join(threads[i], 0x0);
+
+    // totals over every function, then keep the ones using simd.
+    report->scanned = work.count;
+    for (size_t i = 0; i < work.count; i++) {
+        const rda_simd_usage_t* usage = &work.usages[i];
+        bool simd = usage->ops_256 || usage->ops_512;
+        for (int type = 0; type <= RDA_INST_TY_SVE; type++) {
+            report->types[type] += usage->types[type];
+            if (type >= RDA_INST_TY_SSE && usage->types[type]) simd = true;
+        }
+        report->ops_256 += usage->ops_256;
+        report->ops_512 += usage->ops_512;
+        report->generic += usage->generic;
+        report->undecoded += (usage->flags & RDA_SIMD_FL_UNDECODED) != 0;
+        if (simd || policy->all)
+            work.usages[report->count++] = *usage;
+    }
+    report->functions = work.usages;
+    return report;
+};
+
+/**
+ * @brief free a simd usage report.
+ *
+ * @param report the report to be freed.
+ */
+void
+rda_simd_report_destroy(rda_simd_report_t* report) {
+    if (!report) return;
+    free(report->functions);
+    free(report);
+};
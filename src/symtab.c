@@ -0,0 +1,665 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file symtab.c
+ */
+#define _GNU_SOURCE
+#include "symtab.h"
+
+/*! @uses calloc, free, qsort */
+#include <stdlib.h>
+
+/*! @uses memcpy, memcmp, strcmp, strncmp, strlen, strnlen, strspn */
+#include <string.h>
+
+/*! @uses uint32_t, int32_t, SIZE_MAX */
+#include <stdint.h>
+
+/*! @uses dl_iterate_phdr, ElfW */
+#include <link.h>
+
+/*! @uses open, O_RDONLY */
+#include <fcntl.h>
+
+/*! @uses mmap, munmap */
+#include <sys/mman.h>
+
+/*! @uses fstat */
+#include <sys/stat.h>
+
+/*! @uses close */
+#include <unistd.h>
+
+/*! @uses call_once, once_flag */
+#include <threads.h>
+
+/*! @uses rda_internal */
+#include "lib.h"
+
+/*! @uses rda_get_branch_target, rda_get_rip_target */
+#include "opnd.h"
+
+/*! @uses rda_vec_t, RDA_VEC_TYPED */
+#include "vec.h"
+
+/// @note typed access to vectors of symbols, stubs and characters.
+RDA_VEC_TYPED(symbol_vec, rda_symbol_t)
+RDA_VEC_TYPED(stub_vec, rda_plt_stub_t)
+RDA_VEC_TYPED(char_vec, char)
+
+/// @note a got slot bound to a symbol by a JUMP_SLOT or GLOB_DAT relocation.
+typedef struct {
+    size_t slot;                    // runtime address of the slot.
+    size_t name;                    // offset of the name in the string pool.
+} rda_slot_t;
+
+/// @note typed access to a vector of rda_slot_t.
+RDA_VEC_TYPED(slot_vec, rda_slot_t)
+
+/**
+ * @note the state of a build; names are string pool offsets (stored in the
+ *	pointers) until the pool stops growing.
+ */
+typedef struct {
+    rda_vec_t symbols;              // rda_symbol_t.
+    rda_vec_t stubs;                // rda_plt_stub_t.
+    rda_vec_t strings;              // char.
+    size_t module;                  // offset of the current module path.
+    size_t base;                    // load bias of the current module.
+} rda_symtab_build_t;
+
+/// @note a read-only mapping of a module file.
+typedef struct {
+    const unsigned char* image;     // the file contents.
+    size_t size;                    // the file size.
+    const ElfW(Shdr)* sections;     // the section headers.
+    size_t section_count;           // number of <sections>.
+} rda_elf_file_t;
+
+/**
+ * @brief copy a string into the string pool.
+ *
+ * @return its offset.
+ */
+rda_internal size_t
+intern(rda_vec_t* strings, const char* string, size_t length) {
+    size_t offset = strings->length, needed = offset + length + 1;
+    if (needed > strings->capacity && !rda_vec_reserve(strings, needed * 2)) return 0;
+    char* at = char_vec_data(strings) + offset;
+    memcpy(at, string, length);
+    at[length] = '\0';
+    strings->length += length + 1;
+    return offset;
+};
+
+/**
+ * @brief add a symbol if it is a defined function or object.
+ *
+ * @param build the build.
+ * @param symbol the elf symbol.
+ * @param name the name of the symbol.
+ * @param limit the size of the string table <name> points into (from <name>).
+ */
+rda_internal void
+add_symbol(rda_symtab_build_t* build, const ElfW(Sym)* symbol, const char* name, size_t limit) {
+    unsigned char type = ELF64_ST_TYPE(symbol->st_info), bind = ELF64_ST_BIND(symbol->st_info);
+    if (type != STT_FUNC && type != STT_GNU_IFUNC && type != STT_OBJECT) return;
+    if (symbol->st_shndx == SHN_UNDEF || symbol->st_shndx == SHN_ABS || !symbol->st_value) return;
+    size_t length = strnlen(name, limit);
+    if (!length || length == limit) return;
+
+    rda_symbol_t entry = {
+        .address = build->base + symbol->st_value,
+        .size = symbol->st_size,
+        .name = (const char*) intern(&build->strings, name, length),
+        .module = (const char*) build->module,
+        .type = type,
+        .global = bind == STB_GLOBAL || bind == STB_WEAK || bind == STB_GNU_UNIQUE,
+    };
+    symbol_vec_push(&build->symbols, &entry);
+};
+
+/**
+ * @brief map a module file read-only and find its section headers.
+ *
+ * @return false if the file cannot be read or has no section headers.
+ */
+rda_internal bool
+map_file(const char* path, rda_elf_file_t* file) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(ElfW(Ehdr))) {
+        close(fd);
+        return false;
+    }
+    file->size = (size_t) st.st_size;
+    file->image = mmap(0x0, file->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (file->image == MAP_FAILED) return false;
+
+    const ElfW(Ehdr)* ehdr = (const ElfW(Ehdr)*) file->image;
+    if (memcmp(ehdr->e_ident, ELFMAG, SELFMAG) != 0 || ehdr->e_ident[EI_CLASS] != ELFCLASS64 || \
+        !ehdr->e_shoff || ehdr->e_shentsize != sizeof(ElfW(Shdr)) || ehdr->e_shstrndx >= ehdr->e_shnum || \
+        ehdr->e_shoff + (size_t) ehdr->e_shnum * sizeof(ElfW(Shdr)) > file->size) {
+        munmap((void*) file->image, file->size);
+        return false;
+    }
+    file->sections = (const ElfW(Shdr)*) (file->image + ehdr->e_shoff);
+    file->section_count = ehdr->e_shnum;
+    return true;
+};
+
+/**
+ * @brief get the contents of a section, if they lie within the file.
+ */
+rda_internal const unsigned char*
+section_data(const rda_elf_file_t* file, size_t index) {
+    if (index >= file->section_count) return 0x0;
+    const ElfW(Shdr)* section = &file->sections[index];
+    if (section->sh_type == SHT_NOBITS || section->sh_offset + section->sh_size > file->size) return 0x0;
+    return file->image + section->sh_offset;
+};
+
+/**
+ * @brief get the name of a section.
+ */
+rda_internal const char*
+section_name(const rda_elf_file_t* file, const ElfW(Shdr)* section) {
+    const ElfW(Ehdr)* ehdr = (const ElfW(Ehdr)*) file->image;
+    const ElfW(Shdr)* names = &file->sections[ehdr->e_shstrndx];
+    if (section->sh_name >= names->sh_size || names->sh_offset + names->sh_size > file->size) return "";
+    return (const char*) file->image + names->sh_offset + section->sh_name;
+};
+
+/**
+ * @brief add the symbols of a symbol table section (.symtab or .dynsym).
+ */
+rda_internal void
+add_section_symbols(rda_symtab_build_t* build, const rda_elf_file_t* file, size_t index) {
+    const ElfW(Shdr)* table = &file->sections[index];
+    const ElfW(Sym)* symbols = (const ElfW(Sym)*) section_data(file, index);
+    const char* strings = (const char*) section_data(file, table->sh_link);
+    if (!symbols || !strings) return;
+    size_t limit = file->sections[table->sh_link].sh_size;
+    for (size_t i = 1; i < table->sh_size / sizeof *symbols; i++)
+        if (symbols[i].st_name < limit)
+            add_symbol(build, &symbols[i], strings + symbols[i].st_name, limit - symbols[i].st_name);
+};
+
+/**
+ * @brief collect the got slots bound by JUMP_SLOT and GLOB_DAT relocations.
+ */
+rda_internal void
+collect_slots(rda_symtab_build_t* build, const rda_elf_file_t* file, rda_vec_t* slots) {
+    for (size_t i = 0; i < file->section_count; i++) {
+        const ElfW(Shdr)* section = &file->sections[i];
+        if (section->sh_type != SHT_RELA || section->sh_link >= file->section_count) continue;
+        const ElfW(Shdr)* table = &file->sections[section->sh_link];
+        const ElfW(Rela)* relas = (const ElfW(Rela)*) section_data(file, i);
+        const ElfW(Sym)* symbols = (const ElfW(Sym)*) section_data(file, section->sh_link);
+        const char* strings = (const char*) section_data(file, table->sh_link);
+        if (!relas || !symbols || !strings) continue;
+        size_t limit = file->sections[table->sh_link].sh_size;
+
+        for (size_t j = 0; j < section->sh_size / sizeof *relas; j++) {
+            unsigned int type = ELF64_R_TYPE(relas[j].r_info);
+            size_t symbol = ELF64_R_SYM(relas[j].r_info);
+            if ((type != R_X86_64_JUMP_SLOT && type != R_X86_64_GLOB_DAT) || !symbol || \
+                symbol >= table->sh_size / sizeof *symbols || symbols[symbol].st_name >= limit)
+                continue;
+            const char* name = strings + symbols[symbol].st_name;
+            rda_slot_t entry = { build->base + relas[j].r_offset, \
+                intern(&build->strings, name, strnlen(name, limit - symbols[symbol].st_name)) };
+            slot_vec_push(slots, &entry);
+        }
+    }
+};
+
+/// @brief order slots by address.
+rda_internal int
+compare_slots(const void* a, const void* b) {
+    const rda_slot_t* x = a, *y = b;
+    return (x->slot > y->slot) - (x->slot < y->slot);
+};
+
+/**
+ * @brief find the string pool offset of the name a got slot is bound to.
+ *
+ * @return the offset, or SIZE_MAX if the slot is not bound by name.
+ */
+rda_internal size_t
+slot_name(const rda_vec_t* slots, size_t slot) {
+    size_t low = 0, high = slots->length;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (slot_vec_at(slots, middle)->slot < slot) low = middle + 1;
+        else high = middle;
+    }
+    return low < slots->length && slot_vec_at(slots, low)->slot == slot ? slot_vec_at(slots, low)->name : SIZE_MAX;
+};
+
+/**
+ * @brief add the stubs of the plt sections; a stub is an optional endbr64,
+ *  then a (bnd) jmp [rip + disp32] through a got slot.
+ */
+rda_internal void
+add_stubs(rda_symtab_build_t* build, const rda_elf_file_t* file, const rda_vec_t* slots) {
+    for (size_t i = 0; i < file->section_count; i++) {
+        const ElfW(Shdr)* section = &file->sections[i];
+        const char* name = section_name(file, section);
+        if (!(section->sh_flags & SHF_EXECINSTR) || strncmp(name, ".plt", 4) != 0) continue;
+
+        // the stubs are read from the live (mapped) section.
+        const unsigned char* code = (const unsigned char*) (build->base + section->sh_addr);
+        size_t size = section->sh_size, start = SIZE_MAX;
+        for (size_t at = 0; at < size; ) {
+            if (at + 4 <= size && code[at] == 0xf3 && code[at + 1] == 0x0f && code[at + 2] == 0x1e && code[at + 3] == 0xfa) {
+                start = at;
+                at += 4;
+                continue;
+            }
+            size_t jmp = at + (code[at] == 0xf2);
+            if (jmp + 6 <= size && code[jmp] == 0xff && code[jmp + 1] == 0x25) {
+                int32_t disp;
+                memcpy(&disp, code + jmp + 2, sizeof disp);
+                size_t end = jmp + 6, slot = (size_t) code + end + (size_t) (intptr_t) disp;
+                size_t bound = slot_name(slots, slot);
+                if (bound != SIZE_MAX) {
+                    rda_plt_stub_t stub = { (size_t) code + (start != SIZE_MAX ? start : at), \
+                        (size_t) code + end, slot, (const char*) bound };
+                    stub_vec_push(&build->stubs, &stub);
+                }
+                start = SIZE_MAX;
+                at = end;
+                continue;
+            }
+            start = SIZE_MAX;
+            at++;
+        }
+    }
+};
+
+/**
+ * @brief get the number of symbols of a dynamic symbol table from its
+ *  DT_GNU_HASH table: one past the last symbol of the longest chain.
+ */
+rda_internal size_t
+gnu_hash_count(const uint32_t* hash) {
+    uint32_t buckets = hash[0], offset = hash[1], bloom = hash[2];
+    const uint32_t* bucket = (const uint32_t*) ((const ElfW(Addr)*) (hash + 4) + bloom);
+    const uint32_t* chain = bucket + buckets;
+    uint32_t last = 0;
+    for (uint32_t i = 0; i < buckets; i++)
+        if (bucket[i] > last) last = bucket[i];
+    if (last < offset) return offset;
+    while (!(chain[last - offset] & 1))
+        last++;
+    return (size_t) last + 1;
+};
+
+/**
+ * @brief add the dynamic symbols of a module from its dynamic section in
+ *  memory, for modules without a readable file.
+ */
+rda_internal void
+add_dynamic_symbols(rda_symtab_build_t* build, const struct dl_phdr_info* info) {
+    const ElfW(Dyn)* dynamic = 0x0;
+    for (size_t i = 0; i < info->dlpi_phnum; i++)
+        if (info->dlpi_phdr[i].p_type == PT_DYNAMIC)
+            dynamic = (const ElfW(Dyn)*) (info->dlpi_addr + info->dlpi_phdr[i].p_vaddr);
+    if (!dynamic) return;
+
+    // the loader relocates some of these in place, but not for every module.
+    size_t symtab = 0, strtab = 0, strsz = 0, count = 0;
+    for (; dynamic->d_tag != DT_NULL; dynamic++) {
+        size_t value = dynamic->d_un.d_ptr;
+        if (value && value < info->dlpi_addr && dynamic->d_tag != DT_STRSZ) value += info->dlpi_addr;
+        switch (dynamic->d_tag) {
+            case DT_SYMTAB: symtab = value; break;
+            case DT_STRTAB: strtab = value; break;
+            case DT_STRSZ: strsz = dynamic->d_un.d_val; break;
+            case DT_GNU_HASH: count = gnu_hash_count((const uint32_t*) value); break;
+            case DT_HASH: if (!count) count = ((const uint32_t*) value)[1]; break;
+            default: break;
+        }
+    }
+    if (!symtab || !strtab || !strsz) return;
+    const ElfW(Sym)* symbols = (const ElfW(Sym)*) symtab;
+    for (size_t i = 1; i < count; i++)
+        if (symbols[i].st_name < strsz)
+            add_symbol(build, &symbols[i], (const char*) strtab + symbols[i].st_name, strsz - symbols[i].st_name);
+};
+
+/**
+ * @brief dl_iterate_phdr callback, add the symbols and stubs of a module.
+ */
+rda_internal int
+add_module(struct dl_phdr_info* info, size_t size, void* data) {
+    (void) size;
+    rda_symtab_build_t* build = data;
+    const char* path = info->dlpi_name && info->dlpi_name[0] ? info->dlpi_name : "/proc/self/exe";
+    build->module = intern(&build->strings, path, strlen(path));
+    build->base = info->dlpi_addr;
+
+    rda_elf_file_t file;
+    if (!map_file(path, &file)) {
+        add_dynamic_symbols(build, info);
+        return 0;
+    }
+
+    // .symtab if the file has one, .dynsym otherwise.
+    size_t table = SIZE_MAX;
+    for (size_t i = 0; i < file.section_count; i++)
+        if (file.sections[i].sh_type == SHT_SYMTAB || (file.sections[i].sh_type == SHT_DYNSYM && table == SIZE_MAX))
+            table = i;
+    if (table != SIZE_MAX) add_section_symbols(build, &file, table);
+    else add_dynamic_symbols(build, info);
+
+    rda_vec_t slots;
+    slot_vec_init(&slots, 0x0);
+    collect_slots(build, &file, &slots);
+    qsort(slot_vec_data(&slots), slots.length, sizeof(rda_slot_t), compare_slots);
+    add_stubs(build, &file, &slots);
+    rda_vec_free(&slots);
+    munmap((void*) file.image, file.size);
+    return 0;
+};
+
+/**
+ * @brief order symbols by address, then the preferred alias first: sized,
+ *  global, functions, fewer leading underscores, then load order.
+ */
+rda_internal int
+compare_symbols(const void* a, const void* b) {
+    const rda_symbol_t* x = a, *y = b;
+    if (x->address != y->address) return x->address < y->address ? -1 : 1;
+    if (!x->size != !y->size) return x->size ? -1 : 1;
+    if (x->global != y->global) return x->global ? -1 : 1;
+    if ((x->type == STT_OBJECT) != (y->type == STT_OBJECT)) return x->type == STT_OBJECT ? 1 : -1;
+    size_t x_underscores = strspn(x->name, "_"), y_underscores = strspn(y->name, "_");
+    if (x_underscores != y_underscores) return x_underscores < y_underscores ? -1 : 1;
+    return (x->module > y->module) - (x->module < y->module);
+};
+
+/// @brief order stubs by address.
+rda_internal int
+compare_stubs(const void* a, const void* b) {
+    const rda_plt_stub_t* x = a, *y = b;
+    return (x->address > y->address) - (x->address < y->address);
+};
+
+/// @brief hash a name (the gnu hash function).
+rda_internal size_t
+hash_name(const char* name) {
+    size_t hash = 5381;
+    for (const unsigned char* c = (const unsigned char*) name; *c; c++)
+        hash = hash * 33 + *c;
+    return hash;
+};
+
+/// @brief check whether a symbol contains an address; an unsized symbol only contains its address.
+rda_internal bool
+symbol_contains(const rda_symbol_t* symbol, size_t address) {
+    return address >= symbol->address && address < symbol->address + (symbol->size ? symbol->size : 1u);
+};
+
+/**
+ * @brief build a symbol table of every loaded module; symbols are read from
+ *  .symtab (or .dynsym) of the module file, and from the dynamic section in
+ *  memory (sized through DT_GNU_HASH) for modules without one, like the vdso.
+ *
+ * @return an allocated table or 0x0 on failure.
+ */
+rda_symtab_t*
+rda_symtab_create(void) {
+    rda_symtab_build_t build = { 0 };
+    symbol_vec_init(&build.symbols, 0x0);
+    stub_vec_init(&build.stubs, 0x0);
+    char_vec_init(&build.strings, 0x0);
+    dl_iterate_phdr(add_module, &build);
+
+    // move everything into exact-size arrays, and turn the offsets into pointers.
+    rda_symtab_t* table = calloc(1u, sizeof *table);
+    size_t buckets = 16;
+    while (buckets < build.symbols.length * 2)
+        buckets <<= 1;
+    if (table) {
+        table->count = build.symbols.length;
+        table->stub_count = build.stubs.length;
+        table->symbols = calloc(table->count ? table->count : 1u, sizeof *table->symbols);
+        table->parents = calloc(table->count ? table->count : 1u, sizeof *table->parents);
+        table->stubs = calloc(table->stub_count ? table->stub_count : 1u, sizeof *table->stubs);
+        table->strings = calloc(build.strings.length ? build.strings.length : 1u, 1u);
+        table->names = calloc(buckets, sizeof *table->names);
+        table->name_mask = buckets - 1;
+    }
+    if (!table || !table->symbols || !table->parents || !table->stubs || !table->strings || !table->names) {
+        rda_symtab_destroy(table);
+        table = 0x0;
+    }
+    else {
+        if (build.strings.length) memcpy(table->strings, char_vec_data(&build.strings), build.strings.length);
+        for (size_t i = 0; i < table->count; i++) {
+            rda_symbol_t symbol = *symbol_vec_at(&build.symbols, i);
+            symbol.name = table->strings + (size_t) symbol.name;
+            symbol.module = table->strings + (size_t) symbol.module;
+            table->symbols[i] = symbol;
+        }
+        for (size_t i = 0; i < table->stub_count; i++) {
+            rda_plt_stub_t stub = *stub_vec_at(&build.stubs, i);
+            stub.name = table->strings + (size_t) stub.name;
+            table->stubs[i] = stub;
+        }
+        qsort(table->stubs, table->stub_count, sizeof *table->stubs, compare_stubs);
+
+        // names: the first global definition (in load order) wins, then the first local one.
+        qsort(table->symbols, table->count, sizeof *table->symbols, compare_symbols);
+        for (size_t i = 0; i < table->count; i++) {
+            const rda_symbol_t* symbol = &table->symbols[i];
+            size_t parent = i - 1;
+            while (parent != SIZE_MAX && !symbol_contains(&table->symbols[parent], symbol->address))
+                parent = table->parents[parent];
+            table->parents[i] = parent;
+            size_t bucket = hash_name(symbol->name) & table->name_mask;
+            for (; table->names[bucket]; bucket = (bucket + 1) & table->name_mask) {
+                const rda_symbol_t* other = &table->symbols[table->names[bucket] - 1];
+                if (strcmp(other->name, symbol->name) != 0) continue;
+                if ((symbol->global && !other->global) || \
+                    (symbol->global == other->global && symbol->module < other->module))
+                    table->names[bucket] = (unsigned int) i + 1;
+                break;
+            }
+            if (!table->names[bucket])
+                table->names[bucket] = (unsigned int) i + 1;
+        }
+    }
+    rda_vec_free(&build.symbols);
+    rda_vec_free(&build.stubs);
+    rda_vec_free(&build.strings);
+    return table;
+};
+
+/**
+ * @brief free a symbol table.
+ *
+ * @param table the table to be freed.
+ */
+void
+rda_symtab_destroy(rda_symtab_t* table) {
+    if (!table) return;
+    free(table->symbols);
+    free(table->parents);
+    free(table->names);
+    free(table->stubs);
+    free(table->strings);
+    free(table);
+};
+
+/// @note the process-wide table, see rda_get_symtab().
+static rda_symtab_t* g_symtab;
+static once_flag g_symtab_once = ONCE_FLAG_INIT;
+
+/// @brief build the process-wide table.
+rda_internal void
+build_symtab(void) {
+    g_symtab = rda_symtab_create();
+};
+
+/**
+ * @brief get the process-wide symbol table, built on first use; modules
+ *  loaded after that are not covered.
+ *
+ * @return the table or 0x0 on failure.
+ */
+const rda_symtab_t*
+rda_get_symtab(void) {
+    call_once(&g_symtab_once, build_symtab);
+    return g_symtab;
+};
+
+/**
+ * @brief find the symbol containing an address, the one starting nearest to
+ *  it if several do (e.g. a function inside a sized section symbol).
+ *
+ * @param table the table.
+ * @param address the address.
+ * @return the symbol or 0x0.
+ */
+const rda_symbol_t*
+rda_symtab_lookup(const rda_symtab_t* table, size_t address) {
+    if (!table) return 0x0;
+
+    // the last symbol starting at or before the address.
+    size_t low = 0, high = table->count;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (table->symbols[middle].address <= address) low = middle + 1;
+        else high = middle;
+    }
+
+    // every symbol containing the address contains that one's start, so they are all on its chain
+    // of parents, the nearest first (one step per level of nesting).
+    size_t found = low - 1;
+    while (found != SIZE_MAX && !symbol_contains(&table->symbols[found], address))
+        found = table->parents[found];
+    if (found == SIZE_MAX) return 0x0;
+
+    // the preferred alias is the first one at its address containing it.
+    while (found && table->symbols[found - 1].address == table->symbols[found].address && \
+        symbol_contains(&table->symbols[found - 1], address))
+        found--;
+    return &table->symbols[found];
+};
+
+/**
+ * @brief find a symbol by name; global definitions win over local ones, and
+ *  earlier modules (in load order) over later ones.
+ *
+ * @param table the table.
+ * @param name the name.
+ * @return the symbol or 0x0.
+ */
+const rda_symbol_t*
+rda_symtab_find(const rda_symtab_t* table, const char* name) {
+    if (!table || !name) return 0x0;
+    for (size_t bucket = hash_name(name) & table->name_mask; table->names[bucket]; \
+        bucket = (bucket + 1) & table->name_mask) {
+        const rda_symbol_t* symbol = &table->symbols[table->names[bucket] - 1];
+        if (strcmp(symbol->name, name) == 0)
+            return symbol;
+    }
+    return 0x0;
+};
+
+/**
+ * @brief find the plt stub containing an address.
+ *
+ * @param table the table.
+ * @param address the address.
+ * @return the stub or 0x0.
+ */
+const rda_plt_stub_t*
+rda_symtab_stub(const rda_symtab_t* table, size_t address) {
+    if (!table) return 0x0;
+    size_t low = 0, high = table->stub_count;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (table->stubs[middle].address <= address) low = middle + 1;
+        else high = middle;
+    }
+    return low && address < table->stubs[low - 1].end ? &table->stubs[low - 1] : 0x0;
+};
+
+/**
+ * @brief follow a plt stub to the implementation it jumps to (through its got
+ *  slot, or by name while the slot is not bound yet).
+ *
+ * @param table the table.
+ * @param address an address, possibly of a stub.
+ * @return the implementation, or <address> if it is not a stub.
+ */
+size_t
+rda_symtab_resolve(const rda_symtab_t* table, size_t address) {
+    const rda_plt_stub_t* stub = rda_symtab_stub(table, address);
+    if (!stub) return address;
+    size_t bound;
+    memcpy(&bound, (const void*) stub->slot, sizeof bound);
+
+    // a lazily bound slot points at the stub's push of its relocation index
+    //  (after an endbr64), the name is looked up until the loader binds it.
+    const unsigned char* code = (const unsigned char*) bound;
+    if (bound && code[0] == 0xf3 && code[1] == 0x0f && code[2] == 0x1e && code[3] == 0xfa)
+        code += 4;
+    if (!bound || code[0] == 0x68) {
+        const rda_symbol_t* symbol = rda_symtab_find(table, stub->name);
+        return symbol ? symbol->address : address;
+    }
+    return bound;
+};
+
+/**
+ * @brief resolve the branch target of an instruction to a symbol.
+ *
+ * @param table the table.
+ * @param inst a decoded instruction.
+ * @param address the runtime address of <inst>.
+ * @param target pointer to where the target is written.
+ * @return false if <inst> has no direct (or rip-relative indirect) target.
+ */
+bool
+rda_symtab_target(const rda_symtab_t* table, const rda_dec_int_t* inst, size_t address, rda_target_t* target) {
+    if (!table || !inst || !inst->valid || !target) return false;
+    *target = (rda_target_t) { 0 };
+
+    // call/jmp rel, or call/jmp [rip + disp] through a got slot (-fno-plt).
+    size_t slot;
+    if (!rda_get_branch_target(inst, address, &target->target)) {
+        if (!(inst->flags & RDA_INST_FL_BRANCH) || !rda_get_rip_target(inst, address, &slot))
+            return false;
+        memcpy(&target->target, (const void*) slot, sizeof target->target);
+    }
+    target->stub = rda_symtab_stub(table, target->target);
+    target->resolved = target->stub ? rda_symtab_resolve(table, target->target) : target->target;
+    target->symbol = rda_symtab_lookup(table, target->resolved);
+    if (target->symbol) target->offset = target->resolved - target->symbol->address;
+    return true;
+};
+
+/**
+ * @brief disassemble a function by name, exactly its symbol's bytes when the
+ *  size is known (see rda_disassemble_range64()).
+ *
+ * @param name the name of the function.
+ * @return a pointer to an allocated structure containing the information
+ *  about the disassembled function in amd64, 0x0 if there is no such function.
+ */
+rda_dec_fun_t*
+rda_disassemble_symbol(const char* name) {
+    const rda_symbol_t* symbol = rda_symtab_find(rda_get_symtab(), name);
+    if (!symbol || symbol->type == STT_OBJECT) return 0x0;
+    if (!symbol->size) return rda_disassemble64((void*) symbol->address);
+    rda_range_policy_t policy = { 0 };
+    return rda_disassemble_range64((void*) symbol->address, symbol->size, &policy);
+};
@@ -0,0 +1,31 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file tables.c
+ */
+/// @note this is the translation unit the instruction tables live in, see RDA_TABLE.
+#define RDA_TABLE_DEFINITIONS
+
+/*! @uses internal_table, internal_prefix_table */
+#include "asmx64.h"
+
+/*! @uses internal_simd_table */
+#include "simdx64.h"
+
+/*! @uses internal_a64_table, internal_a64_group_table */
+#include "asmarm64.h"
+
+/*! @uses the declarations the other translation units see, checked against the definitions */
+#include "tables.h"
+
+/// @note the row of an invalid instruction, a decoded instruction always refers to a row.
+rda_internal const rda_int_t internal_invalid_row = { 0x0 };
+
+/// @note the row counts other translation units size their arrays with must match the tables.
+_Static_assert(sizeof internal_table / sizeof *internal_table == RDA_INT_TABLE_SIZE,
+    "RDA_INT_TABLE_SIZE does not match internal_table");
+_Static_assert(sizeof internal_simd_table / sizeof *internal_simd_table == RDA_INT_SIMD_TABLE_SIZE,
+    "RDA_INT_SIMD_TABLE_SIZE does not match internal_simd_table");
+_Static_assert(sizeof internal_a64_table / sizeof *internal_a64_table == RDA_A64_TABLE_SIZE,
+    "RDA_A64_TABLE_SIZE does not match internal_a64_table");
@@ -0,0 +1,45 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file tables.h
+ */
+#ifndef LRDA_TABLES_H
+#define LRDA_TABLES_H
+
+/*! @uses rda_int_t, byte_t, RDA_INT_TABLE_SIZE */
+#include "asmx64.h"
+
+/*! @uses RDA_INT_SIMD_TABLE_SIZE */
+#include "simdx64.h"
+
+/*! @uses rda_a64_int_t, RDA_A64_TABLE_SIZE */
+#include "asmarm64.h"
+
+/*! @uses rda_internal */
+#include "lib.h"
+
+/*!
+ * @note the declarations of the instruction tables defined by tables.c; this
+ *	header is private to src/ and not installed, the tables are internal to
+ *	librda and cannot be linked against from outside the library.
+ */
+
+/// @note the prefix detection lookup table (see asmx64.h).
+extern rda_internal const byte_t internal_prefix_table[256];
+
+/// @note the general amd64 instruction table (see asmx64.h).
+extern rda_internal const rda_int_t internal_table[RDA_INT_TABLE_SIZE];
+
+/// @note the simd amd64 instruction table (see simdx64.h).
+extern rda_internal const rda_int_t internal_simd_table[RDA_INT_SIMD_TABLE_SIZE];
+
+/// @note the row of an invalid instruction, every field zero.
+extern rda_internal const rda_int_t internal_invalid_row;
+
+/// @note the aarch64 encoding group categories (see asmarm64.h).
+extern rda_internal const rda_int_ty_t internal_a64_group_table[16];
+
+/// @note the aarch64 instruction table (see asmarm64.h).
+extern rda_internal const rda_a64_int_t internal_a64_table[RDA_A64_TABLE_SIZE];
+#endif //LRDA_TABLES_H
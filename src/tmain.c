@@ -7,9 +7,28 @@
  */
 #include <stddef.h>
 #include <stdio.h>
+#include <dlfcn.h>
+#include <sys/mman.h>
 
 #include "lib.h"
 #include "disas.h"
+#include "fmt.h"
+#include "disarm64.h"
+#include "sig.h"
+#include "query.h"
+#include "ipmap.h"
+#include "async.h"
+#include "unwind.h"
+#include "symtab.h"
+#include "gadget.h"
+#include "callgraph.h"
+#include "memmap.h"
+#include "sampler.h"
+#include "simdscan.h"
+#include "align.h"
+#include "fprint.h"
+#include "cache.h"
+#include "integrity.h"
 
 int some_function(int a, int b) {
 	int i = b;
@@ -44,12 +63,64 @@ double example_regular_floating_point2(double a, float b) {
 	return a*a + b/ 7.2;
 }
 
+// an aarch64 function (prologue, load, compare/branch, call, sve, neon, fp, epilogue).
+static const unsigned char arm64_function[] = {
+	0xfd, 0x7b, 0xbe, 0xa9, // stp x29, x30, [sp, #-32]!
+	0xfd, 0x03, 0x00, 0x91, // mov x29, sp
+	0xf3, 0x0b, 0x00, 0xf9, // str x19, [sp, #16]
+	0xf3, 0x03, 0x00, 0xaa, // mov x19, x0
+	0x60, 0x06, 0x40, 0xb9, // ldr w0, [x19, #4]
+	0x00, 0x04, 0x00, 0x11, // add w0, w0, #1
+	0x1f, 0x28, 0x00, 0x71, // cmp w0, #10
+	0x41, 0x00, 0x00, 0x54, // b.ne #8
+	0xf0, 0xff, 0xff, 0x97, // bl #-64
+	0xe0, 0xe3, 0x98, 0x25, // ptrue p0.s
+	0x00, 0x40, 0x41, 0xa5, // ld1w {z0.s}, p0/z, [x0, x1, lsl #2]
+	0x20, 0x84, 0xa2, 0x4e, // add v0.4s, v1.4s, v2.4s
+	0x00, 0x28, 0x21, 0x1e, // fadd s0, s0, s1
+	0xf3, 0x0b, 0x40, 0xf9, // ldr x19, [sp, #16]
+	0xfd, 0x7b, 0xc2, 0xa8, // ldp x29, x30, [sp], #32
+	0xc0, 0x03, 0x5f, 0xd6, // ret
+};
+
+// a function with another one nested in it (a sized symbol inside a sized symbol), both spinning.
+void nested_outer(unsigned int spins);
+void nested_inner(unsigned int spins);
+__asm__(
+	".text\n"
+	".globl nested_outer\n"
+	".type nested_outer, @function\n"
+	"nested_outer:\n"
+	"	mov %edi, %ecx\n"
+	"1:	dec %ecx\n"
+	"	jnz 1b\n"
+	"	call nested_inner\n"
+	"	ret\n"
+	".globl nested_inner\n"
+	".type nested_inner, @function\n"
+	"nested_inner:\n"
+	"	mov %edi, %ecx\n"
+	"2:	dec %ecx\n"
+	"	jnz 2b\n"
+	"	ret\n"
+	".size nested_inner, .-nested_inner\n"
+	"	int3\n"
+	".size nested_outer, .-nested_outer\n");
+
 int other_function(int x, size_t z) {
 	size_t y = z*z + x;
 	printf("%zu\n", y+111);
 	return (int)(y % 7);
 }
 
+// print a modified instruction an integrity scan reports, and keep its address.
+bool note_patch(const rda_patch_t* patch, void* data) {
+	printf("%s at %s+%zu, was %s\n", patch->live.instruction->mnemonic, patch->symbol ? patch->symbol : "?",
+		patch->address - patch->function, patch->original.instruction->mnemonic);
+	*(size_t*) data = patch->address;
+	return true;
+}
+
 // entry point for testing.
 int main(int argc, char** argv) {
 	rda_context_t ctx = (rda_context_t) {
@@ -59,22 +130,221 @@ int main(int argc, char** argv) {
 	rda_begin(ctx);
 
 	// disassemble some example functions.
+	char text[8192];
 	rda_dec_fun_t* function = rda_disassemble64(&other_function);
-	for (size_t i = 0; i < function->list->length; i++) {
-		printf("%s\n", rda_get_instruction_at(function, i)->instruction.mnemonic);
+	rda_format_function(function, RDA_SYNTAX_INTEL, text, sizeof text);
+	fputs(text, stdout);
+	rda_format_function(function, RDA_SYNTAX_ATT, text, sizeof text);
+	fputs(text, stdout);
+
+	// index the function and list its calls.
+	rda_index_t* index = rda_index_create(&function, 1u);
+	rda_query_t calls = { .flags = RDA_INST_FL_CALL };
+	rda_cursor_t cursor;
+	size_t row;
+	rda_query_begin(index, &calls, &cursor);
+	while (rda_query_next(&cursor, &row))
+		printf("call at %#zx\n", index->address[row]);
+	rda_index_destroy(index);
+
+	// name the call targets, through the plt.
+	for (size_t i = 0; i < function->list.length; i++) {
+		rda_dec_int_t* inst = rda_get_instruction_at(function, i);
+		rda_target_t target;
+		if ((inst->flags & RDA_INST_FL_CALL) && \
+			rda_symtab_target(rda_get_symtab(), inst, function->address + (inst->bytes - function->bytes), &target))
+			printf("call %s%s\n", target.symbol ? target.symbol->name : "?", target.stub ? " (via plt)" : "");
+	}
+
+	// attribute a sample taken inside the function to its instruction.
+	rda_ipmap_t* map = rda_ipmap_create(&function, 1u);
+	rda_ip_hit_t hit;
+	if (rda_ipmap_lookup(map, function->address + function->length / 2, &hit))
+		printf("sample in %s at %#zx\n", hit.inst->instruction->mnemonic, hit.address);
+	rda_ipmap_destroy(map);
+
+	// the frame rule of every instruction of the function.
+	rda_unwind_table_t* unwind = rda_unwind_create(&function, 1u);
+	for (size_t i = 0; unwind && i < unwind->rule_count; i++)
+		printf("+%u\tcfa = %s%+d\n", unwind->rules[i].offset,
+			unwind->rules[i].base == RDA_UNWIND_RBP ? "rbp" : "rsp", unwind->rules[i].cfa);
+	rda_unwind_destroy(unwind);
+
+	// the branches of the function hit by the jcc erratum, and its misaligned loops.
+	rda_align_report_t* alignment = rda_align_create(&function, 1u);
+	for (size_t i = 0; alignment && i < alignment->branch_count; i++)
+		printf("branch at +%zu %s a 32-byte boundary, pad %u\n", alignment->branches[i].offset,
+			alignment->branches[i].flags & RDA_ALIGN_CROSSES ? "crosses" : "ends on", alignment->branches[i].padding);
+	for (size_t i = 0; alignment && i < alignment->loop_count; i++)
+		printf("loop at +%zu spans %u lines instead of %u, pad %u\n", alignment->loops[i].offset,
+			alignment->loops[i].lines, alignment->loops[i].min_lines, alignment->loops[i].padding);
+	rda_align_destroy(alignment);
+
+	// match the function against an index of fingerprints, by its normalized instruction stream.
+	rda_dec_fun_t* other = rda_disassemble64(&some_function);
+	rda_fprint_t fprints[2];
+	if (rda_fprint_compute(function, &fprints[0]) && rda_fprint_compute(other, &fprints[1])) {
+		rda_fprint_index_t* fingerprints = rda_fprint_index_create(fprints, 2u);
+		rda_fprint_match_t matches[2];
+		size_t found = rda_fprint_index_query(fingerprints, &fprints[0], matches, 2u);
+		for (size_t i = 0; i < found; i++)
+			printf("fingerprint %zu: %.2f%s\n", matches[i].index, matches[i].similarity,
+				matches[i].exact ? " (exact)" : "");
+		rda_fprint_index_destroy(fingerprints);
+	}
+	rda_free_function(other);
+
+	// round trip the function through a cache file, and compare it with the decoder.
+	rda_cache_t* cache = rda_cache_write("/tmp/rda-tmain.cache", &function, 1u) ? \
+		rda_cache_open("/tmp/rda-tmain.cache", &other_function) : 0x0;
+	rda_dec_fun_t* cached = rda_cache_load(cache, cache ? rda_cache_find(cache, &other_function) : 0x0);
+	bool same = cached && cached->length == function->length && cached->list.length == function->list.length;
+	for (size_t i = 0; same && i < function->list.length; i++) {
+		const rda_dec_int_t* a = rda_get_instruction_at(function, i), * b = rda_get_instruction_at(cached, i);
+		same = a->id == b->id && a->length == b->length && a->flags == b->flags && a->valid == b->valid;
+	}
+	printf("cache round trip: %s\n", same ? "same" : "different");
+	rda_free_function(cached);
+	rda_cache_close(cache);
+
+	// decode rda_vec_push in the background.
+	puts("\n\n");
+	rda_async_t* pool = rda_async_create(0u);
+	rda_future_t* future = rda_async_submit(pool, &rda_vec_push, 0, 0x0, 0x0);
+	function = rda_future_wait(future);
+	for (size_t i = 0; i < function->list.length; i++) {
+		printf("%s\n", rda_get_instruction_at(function, i)->instruction->mnemonic);
+	}
+	rda_future_release(future);
+	rda_async_destroy(pool);
+
+	// find every frame setup (push rbp; mov rbp, rsp) in this module.
+	rda_sig_t prologue;
+	rda_sig_compile("55 48 89 e5", &prologue);
+	printf("\n\nframe setups: %zu\n", rda_sig_scan_module(&main, &prologue, 1u, true, 0x0, 0x0));
+
+	// count the gadgets of every loaded module, by terminator.
+	rda_gadget_set_t* gadgets = rda_gadgets_create(&(rda_gadget_policy_t) { .max_instructions = 4 });
+	if (gadgets) {
+		size_t kinds[RDA_GADGET_ALL + 1] = { 0 };
+		for (size_t i = 0; i < gadgets->count; i++)
+			kinds[gadgets->gadgets[i].kind]++;
+		printf("gadgets: %zu (ret %zu, jmp %zu, call %zu)\n", gadgets->count,
+			kinds[RDA_GADGET_RET], kinds[RDA_GADGET_JMP], kinds[RDA_GADGET_CALL]);
+		rda_gadgets_destroy(gadgets);
+	}
+
+	// the call graph reachable from printf (past its plt stub), through plt stubs.
+	void* roots[] = { (void*) rda_symtab_resolve(rda_get_symtab(), (size_t) &printf) };
+	rda_callgraph_t* graph = rda_callgraph_create(roots, 1u, &(rda_callgraph_policy_t) { .plt = true });
+	if (graph) {
+		printf("call graph: %zu functions, %zu call sites%s\n", graph->count, graph->edge_count,
+			graph->truncated ? " (truncated)" : "");
+		rda_callgraph_destroy(graph);
+	}
+
+	// learn which rows printf decodes with, then order the candidates by them.
+	ctx.learn = true;
+	rda_begin(ctx);
+	rda_free_function(rda_disassemble64(roots[0]));
+	static rda_profile_t profile;
+	rda_get_profile(&profile);
+	ctx.learn = false;
+	ctx.profile = &profile;
+	rda_begin(ctx);
+
+	// the mapping holding main, and how far reads from main can go.
+	const rda_mapping_t* mapping = rda_memmap_lookup(rda_get_memmap(), (size_t) &main);
+	if (mapping)
+		printf("main in %#zx-%#zx (%c%c%c), %zu bytes readable\n", mapping->start, mapping->end,
+			mapping->rights & RDA_MAP_READ ? 'r' : '-', mapping->rights & RDA_MAP_WRITE ? 'w' : '-',
+			mapping->rights & RDA_MAP_EXEC ? 'x' : '-', mapping->reach - (size_t) &main);
+
+	// a module unloaded after the map was read is not read from.
+	void* libm = dlopen("libm.so.6", RTLD_NOW | RTLD_LOCAL);
+	void* cosine = libm ? dlsym(libm, "cos") : 0x0;
+	if (cosine) {
+		rda_begin(ctx);
+		size_t loaded = rda_memmap_readable(cosine, 4u * RDA_PAGE_SIZE);
+		dlclose(libm);
+		rda_dec_fun_t* unloaded = rda_disassemble64(cosine);
+		printf("cos: %zu bytes readable while loaded, %zu bytes decoded after dlclose\n", loaded,
+			unloaded ? unloaded->length : 0u);
+		rda_free_function(unloaded);
+	}
+
+	// sample this process for a while, then list where the time went.
+	if (rda_sampler_start(0x0)) {
+		volatile int sink = 0;
+		for (int i = 0; i < 20000; i++)
+			sink += some_function(i, i);
+		nested_outer(200000000u);
+		rda_sampler_stop();
+	}
+	rda_hotspots_t* hotspots = rda_hotspots_create();
+	for (size_t i = 0; hotspots && i < hotspots->function_count && i < 3; i++)
+		printf("%zu samples in %s\n", hotspots->functions[i].samples, hotspots->functions[i].symbol->name);
+
+	// a nested function takes its own samples, and clips the decoded part of the one containing it.
+	for (size_t i = 0; hotspots && i < hotspots->function_count; i++) {
+		const rda_hot_function_t* function = &hotspots->functions[i];
+		if (function->symbol->address == (size_t) &nested_outer || function->symbol->address == (size_t) &nested_inner)
+			printf("%zu samples in %s, %zu bytes decoded\n", function->samples, function->symbol->name,
+				function->function ? function->function->length : 0u);
+	}
+	if (hotspots)
+		printf("%zu samples past a decoded function\n", hotspots->types[RDA_INST_TY_INVALID]);
+	for (size_t i = 0; hotspots && i < hotspots->instruction_count && i < 3; i++)
+		printf("%zu samples at %#zx %s\n", hotspots->instructions[i].samples, hotspots->instructions[i].address,
+			hotspots->instructions[i].inst->instruction->mnemonic);
+	rda_hotspots_destroy(hotspots);
+
+	// the functions of every loaded module running 512-bit code or mixing sse and avx.
+	rda_simd_report_t* simd = rda_simd_sweep(0x0);
+	for (size_t i = 0; simd && i < simd->count; i++) {
+		const rda_simd_usage_t* usage = &simd->functions[i];
+		if (usage->flags & (RDA_SIMD_FL_512 | RDA_SIMD_FL_TRANSITION | RDA_SIMD_FL_DIRTY_EXIT))
+			printf("%s (%s): %zu 512-bit, %zu 256-bit, %zu transitions, %zu dirty exits\n", usage->symbol->name,
+				usage->symbol->module, usage->ops_512, usage->ops_256, usage->transitions, usage->dirty_exits);
+	}
+	if (simd)
+		printf("simd: %zu of %zu functions, %zu 512-bit and %zu 256-bit operations, %zu by width only, "
+			"%zu stopped at a vex/evex instruction\n", simd->count, simd->scanned, simd->ops_512, simd->ops_256,
+			simd->generic, simd->undecoded);
+	rda_simd_report_destroy(simd);
+
+	// every loaded module matches its file once relocated, then patch the ret of a function (its page made
+	// writable) and the scan reports exactly that instruction.
+	printf("integrity: %zu modified in the loaded modules\n", rda_integrity_scan(0x0, 0x0));
+	rda_dec_fun_t* patched = rda_disassemble64(&example_regular_floating_point);
+	rda_dec_int_t* ret = patched->list.length ? rda_get_instruction_at(patched, patched->list.length - 1) : 0x0;
+	unsigned char* byte = ret ? (unsigned char*) ret->bytes : 0x0;
+	void* page = (void*) ((size_t) byte & ~(size_t) (RDA_PAGE_SIZE - 1));
+	if (byte && ret->length == 1 && *byte == 0xc3 && !mprotect(page, RDA_PAGE_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC)) {
+		*byte = 0xcc;
+		size_t address = 0;
+		size_t patches = rda_integrity_scan_module(&main, note_patch, &address);
+		*byte = 0xc3;
+		mprotect(page, RDA_PAGE_SIZE, PROT_READ | PROT_EXEC);
+		printf("integrity: %zu modified, %s\n", patches,
+			patches == 1 && address == (size_t) byte ? "the patched ret" : "unexpected");
 	}
+	rda_free_function(patched);
 
+	// disassemble the aarch64 corpus.
 	puts("\n\n");
-	function = rda_disassemble64(&rda_dynl_create);
-	for (size_t i = 0; i < function->list->length; i++) {
-		printf("%s\n", rda_get_instruction_at(function, i)->instruction.mnemonic);
+	function = rda_disassemble_arm64((void*) arm64_function);
+	for (size_t i = 0; i < function->list.length; i++) {
+		rda_dec_a64_int_t* inst = rda_get_instruction_at_arm64(function, i);
+		printf("%08x\t%-40s type=%d flags=%#x\n", inst->word, inst->instruction.mnemonic,
+			inst->instruction.type, inst->flags);
 	}
 
 	// disassemble example_sse2.
 	// printf("\n\n");
 	// function = rda_disassemble64(&example_sse2);
-	// for (size_t i = 0; i < function->list->length; i++) {
-	// 	printf("%s\n", ((rda_dec_int_t*)rda_dynl_get(function->list, i))->instruction.mnemonic);
+	// for (size_t i = 0; i < function->list.length; i++) {
+	// 	printf("%s\n", ((rda_dec_int_t*)rda_inst_vec_at(&function->list, i))->instruction.mnemonic);
 	// }
 
 	// // disassemble example_avx512.
@@ -0,0 +1,40 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file tmain.cpp
+ */
+#include <cstddef>
+#include <cstdio>
+
+#include "rda.hpp"
+
+// the compile-time opcode index, usable in constant expressions.
+static_assert(!rda::opcodes.candidates(0x90).empty());
+
+extern "C" int
+some_cxx_function(int a, int b) {
+	int i = b;
+	for (int j = 0; j < a; j++)
+		i += j;
+	return a * i;
+}
+
+int main() {
+	rda_context_t ctx = {};
+	rda_begin(ctx);
+
+	// disassemble a function and count its control-flow instructions by visiting their types.
+	rda::function function = rda::disassemble(reinterpret_cast<void*>(&some_cxx_function));
+	std::size_t control = 0;
+	for (const rda_dec_int_t& inst : function)
+		control += rda::visit([]<rda_int_ty_t T>(rda::type_tag<T>, const rda_dec_int_t&) {
+			return T == RDA_INST_TY_CONTROL ? 1u : 0u;
+		}, inst);
+	std::printf("some_cxx_function: %zu instructions, %zu control-flow\n", function.size(), control);
+
+	// the candidates of an opcode byte, the rows the decoder tries for it.
+	for (unsigned short id : rda::opcodes.candidates(0x50))
+		std::printf("0x50: %s\n", rda::row(id)->mnemonic);
+	return 0;
+};
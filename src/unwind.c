@@ -0,0 +1,950 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file unwind.c
+ */
+#define _GNU_SOURCE
+#include "unwind.h"
+
+/*! @uses calloc, free, qsort */
+#include <stdlib.h>
+
+/*! @uses memcpy, strlen, strchr */
+#include <string.h>
+
+/*! @uses dl_iterate_phdr, ElfW */
+#include <link.h>
+
+/*! @uses rda_internal */
+#include "lib.h"
+
+/*! @uses rda_get_branch_target */
+#include "opnd.h"
+
+/*! @uses rda_vec_t, RDA_VEC_TYPED */
+#include "vec.h"
+
+/// @note typed access to a vector of rda_unwind_rule_t.
+RDA_VEC_TYPED(rule_vec, rda_unwind_rule_t)
+
+/// @note the dwarf register numbers of rbp and rsp.
+#define DWARF_RBP 6
+#define DWARF_RSP 7
+
+/// @note the maximum depth of DW_CFA_remember_state.
+#define CFI_STACK 8
+
+/// @note the stack state before an instruction, tracked along the control flow.
+typedef struct {
+    bool set;                       // if a path reached the instruction.
+    bool sp_known;                  // if <delta> is known (false after rsp is realigned).
+    int32_t delta;                  // cfa - rsp.
+    bool fp;                        // if rbp is a frame pointer, rbp = cfa - <fp_delta>.
+    int32_t fp_delta;               // cfa - rbp.
+    int16_t rbp;                    // where the caller's rbp is saved relative to the cfa, 0 if not saved.
+} rda_sp_state_t;
+
+/// @note a row of call frame information: the rule from <location> on.
+typedef struct {
+    size_t location;                // runtime address the row starts at.
+    rda_unwind_rule_t rule;         // the rule (its offset is unused).
+} rda_cfi_row_t;
+
+/// @note typed access to a vector of rda_cfi_row_t.
+RDA_VEC_TYPED(cfi_vec, rda_cfi_row_t)
+
+/// @note the state of the call frame information interpreter.
+typedef struct {
+    uint64_t cfa_register;          // dwarf register of the cfa.
+    int64_t cfa_offset;             // offset of the cfa from the register.
+    bool cfa_expression;            // if the cfa is an expression (not supported).
+    int64_t rbp;                    // offset of the saved rbp from the cfa, 0 if not saved.
+    bool rbp_unknown;               // if rbp is saved in a way we do not support.
+} rda_cfi_state_t;
+
+/**
+ * @brief get the register an instruction writes as a register operand (not
+ *  counting push/pop/leave/enter and the forms handled by step_state()).
+ *
+ * @param inst the decoded instruction.
+ * @param op the opcode bytes (past the prefixes).
+ * @return the register number (0-15) or -1.
+ */
+rda_internal int
+written_register(const rda_dec_int_t* inst, const unsigned char* op) {
+    int rex = inst->rex_byte;
+    int extend_reg = (rex & 4) ? 8 : 0, extend_rm = (rex & 1) ? 8 : 0;
+    const rda_int_t* row = inst->instruction;
+    if (row->opcode_length == 1 && !row->modrm) {
+        if (op[0] >= 0xb8 && op[0] <= 0xbf) return (op[0] & 7) | extend_rm;  // mov r, imm
+        if (op[0] > 0x90 && op[0] <= 0x97) return (op[0] & 7) | extend_rm;   // xchg rax, r
+        return -1;
+    }
+    if (!row->modrm) return -1;
+    unsigned char modrm = op[row->opcode_length];
+    int reg = ((modrm >> 3) & 7) | extend_reg, rm = (modrm & 7) | extend_rm;
+    bool direct = (modrm >> 6) == 3;
+
+    // forms whose destination is the reg field.
+    if (row->opcode_length == 1) {
+        switch (op[0]) {
+            case 0x03: case 0x0b: case 0x13: case 0x1b: case 0x23: case 0x2b: case 0x33:
+            case 0x63: case 0x69: case 0x6b: case 0x8b: case 0x8d:
+                return reg;
+            case 0x87:
+                return direct ? (reg == 4 || reg == 5 ? reg : rm) : reg;
+            case 0x01: case 0x09: case 0x11: case 0x19: case 0x21: case 0x29: case 0x31:
+            case 0x89: case 0xc7: case 0xc1: case 0xd1: case 0xd3:
+                return direct ? rm : -1;
+            case 0x81: case 0x83:
+                return direct && ((modrm >> 3) & 7) != 7 ? rm : -1;
+            case 0xf7:
+                return direct && (((modrm >> 3) & 7) == 2 || ((modrm >> 3) & 7) == 3) ? rm : -1;
+            case 0xff:
+                return direct && ((modrm >> 3) & 7) <= 1 ? rm : -1;
+            default:
+                return -1;
+        }
+    }
+    if (row->opcode_length == 2 && op[0] == 0x0f) {
+        if ((op[1] & 0xf0) == 0x40 || op[1] == 0xaf || op[1] == 0xb6 || op[1] == 0xb7 || \
+            op[1] == 0xbe || op[1] == 0xbf)
+            return reg;
+    }
+    return -1;
+};
+
+/**
+ * @brief read the memory operand of lea: [base + disp] with no index.
+ *
+ * @param inst the decoded instruction.
+ * @param op the opcode bytes.
+ * @param base pointer to where the base register is written.
+ * @param disp pointer to where the displacement is written.
+ * @return false for any other addressing form.
+ */
+rda_internal bool
+lea_operand(const rda_dec_int_t* inst, const unsigned char* op, int* base, int32_t* disp) {
+    const unsigned char* at = op + 1;
+    unsigned char modrm = *at++, mod = modrm >> 6;
+    if (mod == 3 || (mod == 0 && (modrm & 7) == 5)) return false;
+    *base = (modrm & 7) | ((inst->rex_byte & 1) ? 8 : 0);
+    if ((modrm & 7) == 4) {
+        unsigned char sib = *at++;
+        if (((sib >> 3) & 7) != 4 || (inst->rex_byte & 2) || (mod == 0 && (sib & 7) == 5))
+            return false;
+        *base = (sib & 7) | ((inst->rex_byte & 1) ? 8 : 0);
+    }
+    *disp = 0;
+    if (mod == 1) *disp = (int8_t) *at;
+    else if (mod == 2) memcpy(disp, at, 4);
+    return true;
+};
+
+/**
+ * @brief apply the stack effect of an instruction to a state.
+ *
+ * @param inst the decoded instruction.
+ * @param state the state before <inst>, replaced by the state after it.
+ * @return false if the effect cannot be modelled.
+ */
+rda_internal bool
+step_state(const rda_dec_int_t* inst, rda_sp_state_t* state) {
+    if (!inst->valid) return false;
+    if (inst->id & RDA_ROW_SIMD) return true;
+    const unsigned char* op = inst->bytes + inst->prefix_count;
+    const rda_int_t* row = inst->instruction;
+    int extend_rm = (inst->rex_byte & 1) ? 8 : 0;
+    unsigned char modrm = row->modrm ? op[row->opcode_length] : 0;
+    int digit = (modrm >> 3) & 7;
+    bool rsp_direct = row->modrm && (modrm >> 6) == 3 && ((modrm & 7) | extend_rm) == 4;
+
+    if (row->opcode_length == 1) {
+        switch (op[0]) {
+            // push and pop.
+            case 0x50: case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57:
+                state->delta += 8;
+                if (((op[0] & 7) | extend_rm) == 5 && !state->rbp)
+                    state->rbp = (int16_t) -state->delta;
+                return true;
+            case 0x58: case 0x59: case 0x5a: case 0x5b: case 0x5c: case 0x5d: case 0x5e: case 0x5f: {
+                int reg = (op[0] & 7) | extend_rm;
+                if (reg == 4 || !state->sp_known) return false;
+                if (reg == 5) {
+                    if (state->rbp == -state->delta) state->rbp = 0;
+                    state->fp = false;
+                }
+                state->delta -= 8;
+                return true;
+            }
+            case 0x68: case 0x6a: case 0x9c:
+                state->delta += 8;
+                return true;
+            case 0x9d:
+                state->delta -= 8;
+                return true;
+            case 0x8f:
+                if (rsp_direct) return false;
+                state->delta -= 8;
+                return true;
+            case 0xff:
+                if (digit == 6) state->delta += 8;
+                else if (digit <= 1 && rsp_direct) return false;
+                return true;
+
+            // leave is mov rsp, rbp; pop rbp.
+            case 0xc9:
+                if (!state->fp) return false;
+                state->delta = state->fp_delta;
+                state->sp_known = true;
+                if (state->rbp == -state->delta) state->rbp = 0;
+                state->delta -= 8;
+                state->fp = false;
+                return true;
+
+            // enter imm16, 0 is push rbp; mov rbp, rsp; sub rsp, imm16.
+            case 0xc8:
+                if (op[3] || !state->sp_known) return false;
+                state->delta += 8;
+                if (!state->rbp) state->rbp = (int16_t) -state->delta;
+                state->fp = true;
+                state->fp_delta = state->delta;
+                state->delta += op[1] | (op[2] << 8);
+                return true;
+
+            // add/sub/and rsp, imm.
+            case 0x81: case 0x83:
+                if (!rsp_direct || digit == 7) break;
+                if (digit == 4) {
+                    // realigning rsp leaves only rbp to find the cfa with.
+                    if (!state->fp) return false;
+                    state->sp_known = false;
+                    return true;
+                }
+                if (digit != 0 && digit != 5) return false;
+                int32_t immediate;
+                if (op[0] == 0x83) immediate = (int8_t) op[2];
+                else memcpy(&immediate, op + 2, 4);
+                state->delta += digit == 5 ? immediate : -immediate;
+                return true;
+
+            // lea rsp, [rsp/rbp + disp] and lea rbp, [rsp + disp].
+            case 0x8d: {
+                int reg = digit | ((inst->rex_byte & 4) ? 8 : 0), base;
+                int32_t disp;
+                if (reg != 4 && reg != 5) return true;
+                if (reg == 5 && !state->sp_known) return false;
+                if (!lea_operand(inst, op, &base, &disp)) {
+                    if (reg == 5) state->fp = false;
+                    return reg != 4;
+                }
+                if (reg == 5) {
+                    state->fp = base == 4;
+                    state->fp_delta = state->delta - disp;
+                    return true;
+                }
+                if (base == 4 && state->sp_known) state->delta -= disp;
+                else if (base == 5 && state->fp) {
+                    state->delta = state->fp_delta - disp;
+                    state->sp_known = true;
+                }
+                else return false;
+                return true;
+            }
+
+            // mov rbp, rsp and mov rsp, rbp.
+            case 0x89: case 0x8b: {
+                if ((modrm >> 6) != 3) break;
+                int reg = digit | ((inst->rex_byte & 4) ? 8 : 0), rm = (modrm & 7) | extend_rm;
+                int destination = op[0] == 0x89 ? rm : reg, source = op[0] == 0x89 ? reg : rm;
+                if (destination == 5 && source == 4) {
+                    if (!state->sp_known) return false;
+                    state->fp = true;
+                    state->fp_delta = state->delta;
+                    return true;
+                }
+                if (destination == 4 && source == 5) {
+                    if (!state->fp) return false;
+                    state->delta = state->fp_delta;
+                    state->sp_known = true;
+                    return true;
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    // anything else that writes rsp cannot be modelled, writing rbp ends the frame pointer
+    // (and with it the cfa, if rsp is not known).
+    int written = written_register(inst, op);
+    if (written == 4 || (written == 5 && !state->sp_known)) return false;
+    if (written == 5) state->fp = false;
+    return true;
+};
+
+/**
+ * @brief get the rule for a tracked state.
+ */
+rda_internal rda_unwind_rule_t
+state_rule(const rda_sp_state_t* state, uint32_t offset) {
+    if (state->sp_known)
+        return (rda_unwind_rule_t) { offset, state->delta, RDA_UNWIND_RSP, RDA_UNWIND_DECODED, state->rbp };
+    return (rda_unwind_rule_t) { offset, state->fp_delta, RDA_UNWIND_RBP, RDA_UNWIND_DECODED, state->rbp };
+};
+
+/**
+ * @brief check whether two paths reach an instruction with the same state.
+ */
+rda_internal bool
+same_state(const rda_sp_state_t* a, const rda_sp_state_t* b) {
+    if (a->sp_known != b->sp_known || a->fp != b->fp || a->rbp != b->rbp) return false;
+    if (a->sp_known && a->delta != b->delta) return false;
+    return !a->fp || a->fp_delta == b->fp_delta;
+};
+
+/**
+ * @brief find the instruction starting at an offset of a function.
+ *
+ * @return its index or -1.
+ */
+rda_internal long
+index_at(const size_t* offsets, size_t count, size_t offset) {
+    size_t low = 0, high = count;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (offsets[middle] < offset) low = middle + 1;
+        else high = middle;
+    }
+    return low < count && offsets[low] == offset ? (long) low : -1;
+};
+
+/**
+ * @brief track the stack state of every instruction of a function along its
+ *  control flow (direct branches only).
+ *
+ * @param function the decoded function.
+ * @param offsets the offset of every instruction.
+ * @param states the states to be written to (zeroed, one per instruction).
+ * @return false if two paths disagree, in which case no state can be trusted.
+ */
+rda_internal bool
+track_states(rda_dec_fun_t* function, const size_t* offsets, rda_sp_state_t* states) {
+    size_t count = function->list.length;
+    size_t* work = calloc(count, sizeof *work);
+    if (!work) return false;
+
+    // every instruction is queued at most once, when a path first reaches it.
+    size_t pending = 0;
+    states[0] = (rda_sp_state_t) { .set = true, .sp_known = true, .delta = 8 };
+    work[pending++] = 0;
+    bool consistent = true;
+    while (pending && consistent) {
+        size_t i = work[--pending];
+        const rda_dec_int_t* inst = rda_get_instruction_at(function, i);
+        rda_sp_state_t out = states[i];
+        if (!step_state(inst, &out)) continue;
+
+        long successors[2] = { -1, -1 };
+        if (!(inst->flags & RDA_INST_FL_TERM) && i + 1 < count)
+            successors[0] = (long) i + 1;
+        size_t address = function->address + offsets[i], target;
+        if ((inst->flags & RDA_INST_FL_BRANCH) && !(inst->flags & (RDA_INST_FL_CALL | RDA_INST_FL_RET)) && \
+            rda_get_branch_target(inst, address, &target) && target >= function->address)
+            successors[1] = index_at(offsets, count, target - function->address);
+        for (size_t k = 0; k < 2; k++) {
+            long j = successors[k];
+            if (j < 0) continue;
+            if (!states[j].set) {
+                states[j] = out;
+                work[pending++] = (size_t) j;
+            }
+            else if (!same_state(&states[j], &out))
+                consistent = false;
+        }
+    }
+    free(work);
+    return consistent;
+};
+
+/// @brief read an unsigned leb128.
+rda_internal uint64_t
+read_uleb(const unsigned char** at, const unsigned char* end) {
+    uint64_t value = 0;
+    for (unsigned int shift = 0; *at < end; shift += 7) {
+        unsigned char byte = *(*at)++;
+        if (shift < 64) value |= (uint64_t) (byte & 0x7f) << shift;
+        if (!(byte & 0x80)) break;
+    }
+    return value;
+};
+
+/// @brief read a signed leb128.
+rda_internal int64_t
+read_sleb(const unsigned char** at, const unsigned char* end) {
+    int64_t value = 0;
+    unsigned int shift = 0;
+    unsigned char byte = 0;
+    while (*at < end) {
+        byte = *(*at)++;
+        if (shift < 64) value |= (int64_t) (byte & 0x7f) << shift;
+        shift += 7;
+        if (!(byte & 0x80)) break;
+    }
+    if (shift < 64 && (byte & 0x40)) value |= -((int64_t) 1 << shift);
+    return value;
+};
+
+/**
+ * @brief read a pointer encoded with a DW_EH_PE_* encoding.
+ *
+ * @param at the cursor.
+ * @param end the end of the data.
+ * @param encoding the encoding.
+ * @param data_base the base of datarel pointers (.eh_frame_hdr).
+ * @param value pointer to where the value is written.
+ * @return false for omitted or unsupported encodings.
+ */
+rda_internal bool
+read_encoded(const unsigned char** at, const unsigned char* end, unsigned char encoding, size_t data_base, size_t* value) {
+    if (encoding == 0xff) return false;
+    const unsigned char* start = *at;
+    size_t width = 0;
+    switch (encoding & 0x0f) {
+        case 0x00: case 0x04: case 0x0c: width = 8; break;
+        case 0x02: case 0x0a: width = 2; break;
+        case 0x03: case 0x0b: width = 4; break;
+        case 0x01: *value = read_uleb(at, end); break;
+        case 0x09: *value = (size_t) read_sleb(at, end); break;
+        default: return false;
+    }
+    if (width) {
+        if (*at + width > end) return false;
+        uint64_t raw = 0;
+        memcpy(&raw, *at, width);
+        // sign extend the signed forms.
+        if ((encoding & 0x08) && width < 8 && (raw >> (width * 8 - 1)) & 1)
+            raw |= ~(uint64_t) 0 << (width * 8);
+        *value = (size_t) raw;
+        *at += width;
+    }
+    switch (encoding & 0x70) {
+        case 0x00: break;
+        case 0x10: *value += (size_t) start; break;
+        case 0x30: *value += data_base; break;
+        default: return false;
+    }
+    if (encoding & 0x80) memcpy(value, (const void*) *value, sizeof *value);
+    return true;
+};
+
+/// @note state passed through dl_iterate_phdr to find the .eh_frame_hdr of a module.
+typedef struct {
+    size_t address;                 // the address to look for.
+    const unsigned char* header;    // the .eh_frame_hdr, if found.
+} rda_eh_query_t;
+
+/**
+ * @brief dl_iterate_phdr callback, find the .eh_frame_hdr of the module
+ *  containing the address.
+ */
+rda_internal int
+find_eh_frame_hdr(struct dl_phdr_info* info, size_t size, void* data) {
+    (void) size;
+    rda_eh_query_t* query = data;
+    bool within = false;
+    const ElfW(Phdr)* header = 0x0;
+    for (size_t i = 0; i < info->dlpi_phnum; i++) {
+        const ElfW(Phdr)* phdr = &info->dlpi_phdr[i];
+        size_t start = info->dlpi_addr + phdr->p_vaddr;
+        if (phdr->p_type == PT_LOAD && query->address >= start && query->address < start + phdr->p_memsz)
+            within = true;
+        if (phdr->p_type == PT_GNU_EH_FRAME)
+            header = phdr;
+    }
+    if (!within) return 0;
+    if (header) query->header = (const unsigned char*) (info->dlpi_addr + header->p_vaddr);
+    return 1;
+};
+
+/**
+ * @brief find the frame description entry (fde) of an address through the
+ *  binary search table of .eh_frame_hdr.
+ *
+ * @param header the .eh_frame_hdr.
+ * @param address the address.
+ * @return the fde or 0x0.
+ */
+rda_internal const unsigned char*
+find_fde(const unsigned char* header, size_t address) {
+    // version 1, with the usual datarel sdata4 table.
+    if (header[0] != 1 || header[3] != 0x3b) return 0x0;
+    const unsigned char* at = header + 4, *end = header + 64;
+    size_t eh_frame, count;
+    if (!read_encoded(&at, end, header[1], (size_t) header, &eh_frame) || \
+        !read_encoded(&at, end, header[2], (size_t) header, &count) || !count)
+        return 0x0;
+
+    // the last entry starting at or below the address.
+    const int32_t* table = (const int32_t*) at;
+    size_t low = 0, high = count;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if ((size_t) header + (size_t) (intptr_t) table[middle * 2] <= address) low = middle + 1;
+        else high = middle;
+    }
+    if (!low) return 0x0;
+    return header + (intptr_t) table[(low - 1) * 2 + 1];
+};
+
+/**
+ * @brief turn the interpreter state into a rule.
+ */
+rda_internal rda_unwind_rule_t
+cfi_rule(const rda_cfi_state_t* state) {
+    rda_unwind_rule_t rule = { .source = RDA_UNWIND_EH_FRAME };
+    if (state->cfa_expression || state->rbp_unknown || state->rbp < INT16_MIN || state->rbp > INT16_MAX || \
+        state->cfa_offset < INT32_MIN || state->cfa_offset > INT32_MAX)
+        return rule;
+    if (state->cfa_register == DWARF_RSP) rule.base = RDA_UNWIND_RSP;
+    else if (state->cfa_register == DWARF_RBP) rule.base = RDA_UNWIND_RBP;
+    else return rule;
+    rule.cfa = (int32_t) state->cfa_offset;
+    rule.rbp = (int16_t) state->rbp;
+    return rule;
+};
+
+/**
+ * @brief add a row, replacing the previous one if it starts at the same location.
+ */
+rda_internal void
+emit_row(rda_vec_t* rows, size_t location, const rda_cfi_state_t* state) {
+    rda_cfi_row_t row = { location, cfi_rule(state) };
+    rda_cfi_row_t* last = rows->length ? cfi_vec_at(rows, rows->length - 1) : 0x0;
+    if (last && last->location == location) *last = row;
+    else cfi_vec_push(rows, &row);
+};
+
+/**
+ * @brief run call frame instructions, emitting a row before every advance.
+ *
+ * @param at the instructions.
+ * @param end the end of the instructions.
+ * @param state the interpreter state.
+ * @param initial the state after the cie instructions (for DW_CFA_restore).
+ * @param location pointer to the current location.
+ * @param caf the code alignment factor.
+ * @param daf the data alignment factor.
+ * @param encoding the pointer encoding of the fde (for DW_CFA_set_loc).
+ * @param rows the rows to be added to, or 0x0 while running the cie.
+ * @return false on an unknown instruction.
+ */
+rda_internal bool
+run_cfi(const unsigned char* at, const unsigned char* end, rda_cfi_state_t* state, const rda_cfi_state_t* initial,
+    size_t* location, uint64_t caf, int64_t daf, unsigned char encoding, rda_vec_t* rows) {
+    rda_cfi_state_t remembered[CFI_STACK];
+    size_t depth = 0;
+    while (at < end) {
+        unsigned char opcode = *at++, low = opcode & 0x3f;
+        uint64_t reg, advance = 0;
+        switch (opcode & 0xc0) {
+            case 0x40: advance = low * caf; break;
+            case 0x80:
+                if (low == DWARF_RBP) state->rbp = (int64_t) read_uleb(&at, end) * daf, state->rbp_unknown = false;
+                else read_uleb(&at, end);
+                continue;
+            case 0xc0:
+                if (low == DWARF_RBP && initial) state->rbp = initial->rbp, state->rbp_unknown = initial->rbp_unknown;
+                continue;
+            default:
+                break;
+        }
+        if (!advance) {
+            switch (opcode) {
+                case 0x00: break;
+                case 0x01: {
+                    size_t next;
+                    if (!read_encoded(&at, end, encoding, 0, &next)) return false;
+                    if (rows) emit_row(rows, *location, state);
+                    *location = next;
+                    break;
+                }
+                case 0x02: advance = (at < end ? *at++ : 0) * caf; break;
+                case 0x03: { uint16_t v = 0; if (at + 2 <= end) memcpy(&v, at, 2); at += 2; advance = v * caf; break; }
+                case 0x04: { uint32_t v = 0; if (at + 4 <= end) memcpy(&v, at, 4); at += 4; advance = v * caf; break; }
+                case 0x05: case 0x11: case 0x2f: {
+                    reg = read_uleb(&at, end);
+                    int64_t offset = opcode == 0x11 ? read_sleb(&at, end) * daf : (int64_t) read_uleb(&at, end) * daf;
+                    if (opcode == 0x2f) offset = -offset;
+                    if (reg == DWARF_RBP) state->rbp = offset, state->rbp_unknown = false;
+                    break;
+                }
+                case 0x06: case 0x07: case 0x08:
+                    reg = read_uleb(&at, end);
+                    if (reg == DWARF_RBP) {
+                        if (opcode == 0x06 && initial) state->rbp = initial->rbp, state->rbp_unknown = initial->rbp_unknown;
+                        else state->rbp = 0, state->rbp_unknown = opcode == 0x07;
+                    }
+                    break;
+                case 0x09:
+                    reg = read_uleb(&at, end);
+                    read_uleb(&at, end);
+                    if (reg == DWARF_RBP) state->rbp_unknown = true;
+                    break;
+                case 0x0a:
+                    if (depth == CFI_STACK) return false;
+                    remembered[depth++] = *state;
+                    break;
+                case 0x0b:
+                    if (!depth) return false;
+                    *state = remembered[--depth];
+                    break;
+                case 0x0c:
+                    state->cfa_register = read_uleb(&at, end);
+                    state->cfa_offset = (int64_t) read_uleb(&at, end);
+                    state->cfa_expression = false;
+                    break;
+                case 0x12:
+                    state->cfa_register = read_uleb(&at, end);
+                    state->cfa_offset = read_sleb(&at, end) * daf;
+                    state->cfa_expression = false;
+                    break;
+                case 0x0d:
+                    state->cfa_register = read_uleb(&at, end);
+                    state->cfa_expression = false;
+                    break;
+                case 0x0e: state->cfa_offset = (int64_t) read_uleb(&at, end); break;
+                case 0x13: state->cfa_offset = read_sleb(&at, end) * daf; break;
+                case 0x0f:
+                    at += read_uleb(&at, end);
+                    state->cfa_expression = true;
+                    break;
+                case 0x10: case 0x16:
+                    reg = read_uleb(&at, end);
+                    at += read_uleb(&at, end);
+                    if (reg == DWARF_RBP) state->rbp_unknown = true;
+                    break;
+                case 0x14: case 0x15:
+                    reg = read_uleb(&at, end);
+                    if (opcode == 0x14) read_uleb(&at, end);
+                    else read_sleb(&at, end);
+                    if (reg == DWARF_RBP) state->rbp_unknown = true;
+                    break;
+                case 0x2e: read_uleb(&at, end); break;
+                default: return false;
+            }
+        }
+        if (advance) {
+            if (rows) emit_row(rows, *location, state);
+            *location += advance;
+        }
+    }
+    return true;
+};
+
+/**
+ * @brief interpret the call frame information (.eh_frame) covering an address.
+ *
+ * @param address an address within the function.
+ * @param rows the rows to be written to, ordered by location.
+ * @param end pointer to where the end of the described range is written.
+ * @return false if there is no usable call frame information.
+ */
+rda_internal bool
+read_cfi(size_t address, rda_vec_t* rows, size_t* end) {
+    rda_eh_query_t query = { .address = address };
+    dl_iterate_phdr(find_eh_frame_hdr, &query);
+    if (!query.header) return false;
+    const unsigned char* fde = find_fde(query.header, address);
+    if (!fde) return false;
+
+    // the fde, and the common information entry (cie) it points back to.
+    uint32_t length, cie_length;
+    memcpy(&length, fde, 4);
+    if (!length || length == 0xffffffffu) return false;
+    const unsigned char* fde_end = fde + 4 + length, *at = fde + 4;
+    int32_t back;
+    memcpy(&back, at, 4);
+    const unsigned char* cie = at - back;
+    at += 4;
+    memcpy(&cie_length, cie, 4);
+    if (!cie_length || cie_length == 0xffffffffu) return false;
+    const unsigned char* cie_end = cie + 4 + cie_length, *c = cie + 8;
+    unsigned char version = *c++;
+    const char* augmentation = (const char*) c;
+    c += strlen(augmentation) + 1;
+    if (strstr(augmentation, "eh")) return false;
+    uint64_t caf = read_uleb(&c, cie_end);
+    int64_t daf = read_sleb(&c, cie_end);
+    if (version == 1) c++;
+    else read_uleb(&c, cie_end);
+    unsigned char encoding = 0x00;
+    if (augmentation[0] == 'z') {
+        uint64_t size = read_uleb(&c, cie_end);
+        const unsigned char* data_end = c + size;
+        for (const char* a = augmentation + 1; *a; a++) {
+            size_t ignored;
+            if (*a == 'R') encoding = *c++;
+            else if (*a == 'L') c++;
+            else if (*a == 'P') {
+                unsigned char personality = *c++;
+                if (!read_encoded(&c, data_end, personality & 0x7f, 0, &ignored)) return false;
+            }
+        }
+        c = data_end;
+    }
+
+    size_t begin, range;
+    if (!read_encoded(&at, fde_end, encoding, 0, &begin) || \
+        !read_encoded(&at, fde_end, encoding & 0x0f, 0, &range))
+        return false;
+    if (augmentation[0] == 'z') {
+        uint64_t size = read_uleb(&at, fde_end);
+        at += size;
+    }
+    if (address < begin || address >= begin + range) return false;
+
+    // the cie sets up the initial state, the fde describes the function.
+    rda_cfi_state_t state = { 0 }, initial;
+    size_t location = begin;
+    if (!run_cfi(c, cie_end, &state, 0x0, &location, caf, daf, encoding, 0x0)) return false;
+    initial = state;
+    location = begin;
+    if (!run_cfi(at, fde_end, &state, &initial, &location, caf, daf, encoding, rows)) return false;
+    emit_row(rows, location, &state);
+    *end = begin + range;
+    return true;
+};
+
+/**
+ * @brief get the row of the call frame information covering an address.
+ */
+rda_internal const rda_cfi_row_t*
+cfi_row_at(const rda_vec_t* rows, size_t end, size_t address) {
+    const rda_cfi_row_t* found = 0x0;
+    for (size_t i = 0; i < rows->length; i++) {
+        const rda_cfi_row_t* row = cfi_vec_at(rows, i);
+        if (row->location > address) break;
+        found = row;
+    }
+    return found && address < end ? found : 0x0;
+};
+
+/**
+ * @brief add the rules of a function, merging instructions with equal rules.
+ *
+ * @param function the decoded function.
+ * @param rules the rules to be added to.
+ */
+rda_internal void
+build_rules(rda_dec_fun_t* function, rda_vec_t* rules) {
+    size_t count = function->list.length;
+    if (!count) return;
+    size_t* offsets = calloc(count, sizeof *offsets);
+    rda_sp_state_t* states = calloc(count, sizeof *states);
+    if (!offsets || !states) {
+        free(offsets);
+        free(states);
+        return;
+    }
+    for (size_t i = 0; i < count; i++)
+        offsets[i] = (size_t) (rda_get_instruction_at(function, i)->bytes - function->bytes);
+
+    // decoded states where the flow is consistent, call frame information elsewhere.
+    bool tracked = track_states(function, offsets, states);
+    rda_vec_t rows;
+    cfi_vec_init(&rows, 0x0);
+    size_t cfi_end = 0;
+    bool cfi = !tracked;
+    for (size_t i = 0; i < count && !cfi; i++)
+        cfi = !states[i].set;
+    if (cfi && !(cfi = read_cfi(function->address, &rows, &cfi_end)))
+        rows.length = 0;
+
+    size_t first = rules->length;
+    for (size_t i = 0; i < count; i++) {
+        rda_unwind_rule_t rule = { (uint32_t) offsets[i], 0, RDA_UNWIND_UNKNOWN, RDA_UNWIND_DECODED, 0 };
+        if (tracked && states[i].set)
+            rule = state_rule(&states[i], (uint32_t) offsets[i]);
+        else if (cfi) {
+            const rda_cfi_row_t* row = cfi_row_at(&rows, cfi_end, function->address + offsets[i]);
+            if (row) {
+                rule = row->rule;
+                rule.offset = (uint32_t) offsets[i];
+            }
+        }
+
+        // merge with the previous rule of this function if nothing changed.
+        rda_unwind_rule_t* last = rules->length > first ? rule_vec_at(rules, rules->length - 1) : 0x0;
+        if (last && last->cfa == rule.cfa && last->base == rule.base && last->source == rule.source && last->rbp == rule.rbp)
+            continue;
+        rule_vec_push(rules, &rule);
+    }
+    rda_vec_free(&rows);
+    free(offsets);
+    free(states);
+};
+
+/// @brief order functions by start address.
+rda_internal int
+compare_functions_by_address(const void* a, const void* b) {
+    const rda_dec_fun_t* x = *(rda_dec_fun_t* const*) a, *y = *(rda_dec_fun_t* const*) b;
+    return (x->address > y->address) - (x->address < y->address);
+};
+
+/**
+ * @brief build unwind rules for decoded amd64 functions; the sp delta of every
+ *  instruction is tracked from push, pop, sub/add rsp, lea, mov rbp/rsp,
+ *  leave and enter along the control flow, and instructions it cannot model
+ *  (or does not reach) take their rule from .eh_frame.
+ *
+ * @param functions decoded functions (non-overlapping, whole functions).
+ * @param count the number of <functions>.
+ * @return an allocated table or 0x0 on failure.
+ */
+rda_unwind_table_t*
+rda_unwind_create(rda_dec_fun_t** functions, size_t count) {
+    if (!functions) return 0x0;
+    rda_dec_fun_t** sorted = calloc(count ? count : 1u, sizeof *sorted);
+    if (!sorted) return 0x0;
+    size_t n = 0;
+    for (size_t i = 0; i < count; i++)
+        if (functions[i] && functions[i]->length) sorted[n++] = functions[i];
+    qsort(sorted, n, sizeof *sorted, compare_functions_by_address);
+
+    rda_unwind_table_t* table = calloc(1u, sizeof *table);
+    if (table) {
+        table->start = calloc(n ? n : 1u, sizeof *table->start);
+        table->end = calloc(n ? n : 1u, sizeof *table->end);
+        table->first = calloc(n + 1, sizeof *table->first);
+    }
+    if (!table || !table->start || !table->end || !table->first) {
+        free(sorted);
+        rda_unwind_destroy(table);
+        return 0x0;
+    }
+
+    rda_vec_t rules;
+    rule_vec_init(&rules, 0x0);
+    for (size_t i = 0; i < n; i++) {
+        table->start[i] = sorted[i]->address;
+        table->end[i] = sorted[i]->address + sorted[i]->length;
+        table->first[i] = (uint32_t) rules.length;
+        build_rules(sorted[i], &rules);
+    }
+    table->count = n;
+    table->first[n] = (uint32_t) rules.length;
+    free(sorted);
+
+    // keep the rules in a single exact-size array.
+    table->rule_count = rules.length;
+    table->rules = calloc(rules.length ? rules.length : 1u, sizeof *table->rules);
+    if (!table->rules) {
+        rda_vec_free(&rules);
+        rda_unwind_destroy(table);
+        return 0x0;
+    }
+    if (rules.length)
+        memcpy(table->rules, rule_vec_data(&rules), rules.length * sizeof *table->rules);
+    rda_vec_free(&rules);
+    return table;
+};
+
+/**
+ * @brief free an unwind table.
+ *
+ * @param table the table to be freed.
+ */
+void
+rda_unwind_destroy(rda_unwind_table_t* table) {
+    if (!table) return;
+    free(table->start);
+    free(table->end);
+    free(table->first);
+    free(table->rules);
+    free(table);
+};
+
+/**
+ * @brief find the unwind rule of an instruction pointer.
+ *
+ * @param table the table.
+ * @param ip the instruction pointer.
+ * @return the rule or 0x0 if <ip> is not covered.
+ */
+const rda_unwind_rule_t*
+rda_unwind_find(const rda_unwind_table_t* table, size_t ip) {
+    if (!table) return 0x0;
+
+    // the function, then the last rule starting at or before the offset.
+    size_t low = 0, high = table->count;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (table->start[middle] <= ip) low = middle + 1;
+        else high = middle;
+    }
+    if (!low || ip >= table->end[low - 1]) return 0x0;
+    size_t function = low - 1, offset = ip - table->start[function];
+    low = table->first[function];
+    high = table->first[function + 1];
+    size_t first = low;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (table->rules[middle].offset <= offset) low = middle + 1;
+        else high = middle;
+    }
+    return low > first ? &table->rules[low - 1] : 0x0;
+};
+
+/**
+ * @brief step from a frame to its caller. the stack is read without checks,
+ *  so <frame> must come from a live thread stack.
+ *
+ * @param table the table.
+ * @param frame the frame, replaced by its caller's.
+ * @param caller true if <frame> is a caller frame (its ip is a return
+ *  address), false for the interrupted frame.
+ * @return false if the frame cannot be unwound.
+ */
+bool
+rda_unwind_step(const rda_unwind_table_t* table, rda_frame_t* frame, bool caller) {
+    // a return address may point past the end of a call to a function that does not return.
+    const rda_unwind_rule_t* rule = rda_unwind_find(table, caller ? frame->ip - 1 : frame->ip);
+    if (!rule || rule->base == RDA_UNWIND_UNKNOWN)
+        return false;
+    size_t cfa = (rule->base == RDA_UNWIND_RSP ? frame->sp : frame->bp) + (size_t) (intptr_t) rule->cfa;
+    if (cfa <= frame->sp && rule->base == RDA_UNWIND_RSP)
+        return false;
+
+    size_t ip, bp = frame->bp;
+    memcpy(&ip, (const void*) (cfa - 8), sizeof ip);
+    if (rule->rbp)
+        memcpy(&bp, (const void*) (cfa + (size_t) (intptr_t) rule->rbp), sizeof bp);
+    *frame = (rda_frame_t) { ip, cfa, bp };
+    return ip != 0;
+};
+
+/**
+ * @brief unwind a stack from an interrupted frame, one lookup per frame.
+ *
+ * @param table the table.
+ * @param frame the interrupted frame.
+ * @param ips the return addresses to be written to, starting with frame.ip.
+ * @param max the capacity of <ips>.
+ * @return the number of addresses written.
+ */
+size_t
+rda_unwind(const rda_unwind_table_t* table, rda_frame_t frame, size_t* ips, size_t max) {
+    if (!ips || !max) return 0;
+    size_t count = 0;
+    ips[count++] = frame.ip;
+    while (count < max) {
+        size_t sp = frame.sp;
+        if (!rda_unwind_step(table, &frame, count > 1) || frame.sp <= sp)
+            break;
+        ips[count++] = frame.ip;
+    }
+    return count;
+};
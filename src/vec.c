@@ -0,0 +1,128 @@
+/**
+ *	@author Sean Hobeck
+ *	@date 18/10/2026
+ *
+ *	@file vec.c
+ */
+#include "vec.h"
+
+/*! @uses malloc, realloc, free */
+#include <stdlib.h>
+
+/*! @uses memcpy, memset */
+#include <string.h>
+
+/*! @uses SIZE_MAX */
+#include <stdint.h>
+
+/*! @uses rda_internal */
+#include "lib.h"
+
+/// @brief get the element storage of a vector.
+rda_internal unsigned char*
+get_data(const rda_vec_t* vec) {
+    return vec->data ? vec->data : (unsigned char*) vec->small.bytes;
+};
+
+/**
+ * @brief initialize an empty vector.
+ *
+ * @param vec the vector.
+ * @param isize the size of an element.
+ * @param arena the arena to grow in, or 0x0 for the heap.
+ */
+void
+rda_vec_init(rda_vec_t* vec, size_t isize, rda_arena_t* arena) {
+    *vec = (rda_vec_t) { .isize = isize ? isize : 1u, .arena = arena };
+    vec->capacity = RDA_VEC_SMALL / vec->isize;
+};
+
+/**
+ * @brief make room for at least <capacity> elements.
+ *
+ * @param vec the vector.
+ * @param capacity the number of elements.
+ * @return false if the allocation failed or <capacity> elements do not fit in a size_t.
+ */
+bool
+rda_vec_reserve(rda_vec_t* vec, size_t capacity) {
+    if (capacity <= vec->capacity)
+        return true;
+    if (capacity > SIZE_MAX / vec->isize)
+        return false;
+
+    // the heap grows in place when it can, the arena and the inline buffer are copied from.
+    void* data;
+    if (vec->arena || !vec->data) {
+        data = vec->arena ? rda_arena_alloc(vec->arena, capacity * vec->isize) : malloc(capacity * vec->isize);
+        if (!data) return false;
+        memcpy(data, get_data(vec), vec->length * vec->isize);
+    }
+    else {
+        data = realloc(vec->data, capacity * vec->isize);
+        if (!data) return false;
+    }
+    vec->data = data;
+    vec->capacity = capacity;
+    return true;
+};
+
+/**
+ * @brief append an element, growing the vector if needed; pointers to
+ *  elements are invalidated when it grows.
+ *
+ * @param vec the vector.
+ * @param item the element to be copied in, or 0x0 for a zeroed element.
+ * @return the new element or 0x0 if the allocation failed.
+ */
+void*
+rda_vec_push(rda_vec_t* vec, const void* item) {
+    // doubling the capacity must not wrap around.
+    size_t grow = vec->capacity < 8 ? 16 : vec->capacity * 2;
+    if (vec->length == vec->capacity && (grow <= vec->capacity || !rda_vec_reserve(vec, grow)))
+        return 0x0;
+
+    unsigned char* slot = get_data(vec) + vec->length++ * vec->isize;
+    if (item) memcpy(slot, item, vec->isize);
+    else memset(slot, 0, vec->isize);
+    return slot;
+};
+
+/**
+ * @brief get the element at an index.
+ *
+ * @param vec the vector.
+ * @param index the index.
+ * @return the element or 0x0 if <index> is out of bounds.
+ */
+void*
+rda_vec_at(const rda_vec_t* vec, size_t index) {
+    if (index >= vec->length) return 0x0;
+    return get_data(vec) + index * vec->isize;
+};
+
+/**
+ * @brief remove the element at an index in O(1) by moving the last element
+ *  into its place (the order of elements is not kept).
+ *
+ * @param vec the vector.
+ * @param index the index.
+ */
+void
+rda_vec_swap_remove(rda_vec_t* vec, size_t index) {
+    if (index >= vec->length) return;
+    unsigned char* data = get_data(vec);
+    if (index != --vec->length)
+        memcpy(data + index * vec->isize, data + vec->length * vec->isize, vec->isize);
+};
+
+/**
+ * @brief free the memory of a vector (not arena memory) and empty it.
+ *
+ * @param vec the vector.
+ */
+void
+rda_vec_free(rda_vec_t* vec) {
+    if (!vec->arena) free(vec->data);
+    rda_vec_init(vec, vec->isize, vec->arena);
+};